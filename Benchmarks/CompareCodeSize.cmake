@@ -0,0 +1,35 @@
+# Compares code size of object files built from BM_SoftTimersCppSizeRaw.cpp and
+# BM_SoftTimersCppSizeWrapper.cpp, wrapper object may not be bigger than raw one.
+# Usage: cmake -DNM=<nm> -DRAW_OBJECT=<object> -DWRAPPER_OBJECT=<object> -P CompareCodeSize.cmake
+
+# Sums sizes of code symbols defined in object file
+function(sftm_get_code_size object result)
+  execute_process(
+    COMMAND ${NM} --print-size --defined-only ${object}
+    OUTPUT_VARIABLE symbols
+    RESULT_VARIABLE nmResult
+  )
+  if(NOT nmResult EQUAL 0)
+    message(FATAL_ERROR "${NM} failed on ${object}")
+  endif()
+
+  set(size 0)
+  string(REPLACE "\n" ";" symbols "${symbols}")
+  foreach(symbol ${symbols})
+    if(symbol MATCHES "^[0-9a-fA-F]+ ([0-9a-fA-F]+) [tTwW] (.+)$")
+      math(EXPR size "${size} + 0x${CMAKE_MATCH_1}")
+      message(STATUS "  ${CMAKE_MATCH_2}: ${CMAKE_MATCH_1}")
+    endif()
+  endforeach()
+  set(${result} ${size} PARENT_SCOPE)
+endfunction()
+
+message(STATUS "Raw C API code symbols (hex sizes):")
+sftm_get_code_size(${RAW_OBJECT} rawSize)
+message(STATUS "C++ wrapper code symbols (hex sizes):")
+sftm_get_code_size(${WRAPPER_OBJECT} wrapperSize)
+message(STATUS "Code size raw: ${rawSize} B, wrapper: ${wrapperSize} B")
+
+if(wrapperSize GREATER rawSize)
+  message(FATAL_ERROR "C++ wrapper code is ${wrapperSize} B, bigger than raw C API code ${rawSize} B")
+endif()
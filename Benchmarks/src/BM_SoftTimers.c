@@ -0,0 +1,242 @@
+/*=======================================================================================*
+ * @file    BM_SoftTimers.c
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains benchmarks for Soft Timers module.
+ *
+ *          Benchmarks measure timers handler cost per tick, events handler cost per
+ *          dispatched callback, advance cost per expiration, latency of start together
+ *          with stop of running timer and restart latency. Every measurement is repeated
+ *          for several armed timers ratios and printed as one JSON object per line. Table
+ *          size is MAX_TIMER_SLOTS, build benchmark with -DMAX_TIMER_SLOTS=<n> to sweep it.
+ *          Optional first argument is a label copied to every result.
+ *======================================================================================*/
+
+/**
+ * @addtogroup Soft Timers Benchmarks
+ * @{
+ * @brief Performance measurements of Soft Timers module.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+#define _POSIX_C_SOURCE 199309L
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "SoftTimers.c"
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+#define BM_TICKS_NUMBER               200        ///< Timer ticks measured per handler benchmark
+#define BM_DISPATCH_ROUNDS            20000      ///< Events handler rounds per dispatch benchmark
+#define BM_API_CALLS                  200000     ///< API calls per latency benchmark
+#define BM_TIMER_TIMEOUT              0x3FFFFFFF ///< Longest timeout kept in running timers heap, never expires
+#define BM_ADVANCE_TICKS              3600000    ///< Ticks advanced at once, one hour of timers clock
+#define BM_ADVANCE_PERIOD             10         ///< Base period of auto reload timers in advance benchmark
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+/*======================================================================================*/
+/*                      ####### LOCAL TYPE DECLARATIONS #######                         */
+/*======================================================================================*/
+/*-------------------------------- OTHER TYPEDEFS --------------------------------------*/
+
+/*------------------------------------- ENUMS ------------------------------------------*/
+
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*--------------------------------- EXPORTED OBJECTS -----------------------------------*/
+
+/*---------------------------------- LOCAL OBJECTS -------------------------------------*/
+static const uint8_t ArmedPercents[] = { 0, 25, 50, 75, 100 };  ///< Swept armed timers ratios
+static SFTM_TimerHandle_T Timers[MAX_TIMER_SLOTS];            ///< Benchmarked timers
+static volatile uint32_t CallbackSink = 0;                    ///< Prevents callback optimization
+static const char *Label = "";                                ///< Label printed with results
+
+/*======================================================================================*/
+/*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
+/*======================================================================================*/
+static uint64_t GetTimeNs(void);
+static uint8_t ArmTimers(uint8_t armedPercent);
+static void PrintResult(const char *name, uint8_t armed, uint32_t operations, uint64_t elapsedNs);
+static void BenchmarkCallback(void *pContext);
+static void Benchmark_TimersHandler(uint8_t armedPercent);
+static void Benchmark_TimersEventsHandler(uint8_t armedPercent);
+static void Benchmark_Advance(uint8_t armedPercent);
+static void Benchmark_TimerApi(uint8_t armedPercent);
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+static uint64_t GetTimeNs(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+
+  return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+static uint8_t ArmTimers(uint8_t armedPercent)
+{
+  uint8_t armedNumber = (uint8_t)(((uint32_t)MAX_TIMER_SLOTS * armedPercent) / 100);
+
+  SFTM_Init();
+  CurrentTimersNumber = 0;
+
+  for (uint8_t timerCnt = 0; timerCnt < MAX_TIMER_SLOTS; timerCnt++)
+  {
+    Timers[timerCnt] = SFTM_CreateTimer();
+  }
+
+  for (uint8_t timerCnt = 0; timerCnt < armedNumber; timerCnt++)
+  {
+    SFTM_StartTimer(Timers[timerCnt], SFTM_ONE_SHOT, BenchmarkCallback, NULL, BM_TIMER_TIMEOUT);
+  }
+
+  return armedNumber;
+}
+
+static void PrintResult(const char *name, uint8_t armed, uint32_t operations, uint64_t elapsedNs)
+{
+  printf("{\"label\":\"%s\",\"benchmark\":\"%s\",\"slots\":%u,\"armed\":%u,\"operations\":%lu,\"ns_per_op\":%.2f}\n",
+         Label, name, (unsigned)MAX_TIMER_SLOTS, (unsigned)armed, (unsigned long)operations,
+         (operations != 0) ? (double)elapsedNs / operations : 0.0);
+}
+
+static void BenchmarkCallback(void *pContext)
+{
+  CallbackSink++;
+}
+
+static void Benchmark_TimersHandler(uint8_t armedPercent)
+{
+  uint8_t armedNumber = ArmTimers(armedPercent);
+  uint32_t calls = BM_TICKS_NUMBER * (TICK_CMP);
+  uint64_t start = GetTimeNs();
+
+  for (uint32_t cnt = 0; cnt < calls; cnt++)
+  {
+    SFTM_TimersHandler();
+  }
+
+  uint64_t elapsed = GetTimeNs() - start;
+
+  PrintResult("timers_handler_call", armedNumber, calls, elapsed);
+  PrintResult("timers_handler_tick", armedNumber, BM_TICKS_NUMBER, elapsed);
+}
+
+static void Benchmark_TimersEventsHandler(uint8_t armedPercent)
+{
+  uint8_t armedNumber = ArmTimers(armedPercent);
+  uint64_t overhead = 0;
+  uint64_t elapsed = 0;
+  uint64_t start;
+
+  for (uint32_t roundCnt = 0; roundCnt < BM_DISPATCH_ROUNDS; roundCnt++)
+  {
+    /* Expire armed timers in timers handler, outside of measurement */
+    for (uint8_t timerCnt = 0; timerCnt < armedNumber; timerCnt++)
+    {
+      SFTM_StopTimer(Timers[timerCnt]);
+      SFTM_StartTimer(Timers[timerCnt], SFTM_ONE_SHOT, BenchmarkCallback, NULL, 1);
+    }
+    for (uint32_t cnt = 0; cnt < (TICK_CMP); cnt++)
+    {
+      SFTM_TimersHandler();
+    }
+
+    start = GetTimeNs();
+    SFTM_TimersEventsHandler();
+    elapsed += GetTimeNs() - start;
+
+    /* Measure time source overhead to subtract it */
+    start = GetTimeNs();
+    overhead += GetTimeNs() - start;
+  }
+  elapsed = (elapsed > overhead) ? (elapsed - overhead) : 0;
+
+  PrintResult("events_handler_round", armedNumber, BM_DISPATCH_ROUNDS, elapsed);
+  PrintResult("events_handler_callback", armedNumber, (uint32_t)armedNumber * BM_DISPATCH_ROUNDS, elapsed);
+}
+
+static void Benchmark_Advance(uint8_t armedPercent)
+{
+  uint8_t armedNumber = ArmTimers(armedPercent);
+  uint32_t expirations;
+  uint64_t start;
+
+  for (uint8_t timerCnt = 0; timerCnt < armedNumber; timerCnt++)
+  {
+    SFTM_StopTimer(Timers[timerCnt]);
+    SFTM_StartTimer(Timers[timerCnt], SFTM_AUTO_RELOAD, BenchmarkCallback, NULL, BM_ADVANCE_PERIOD + timerCnt);
+  }
+
+  CallbackSink = 0;
+  start = GetTimeNs();
+  SFTM_Advance(BM_ADVANCE_TICKS);
+  expirations = CallbackSink;
+
+  PrintResult("advance_expiration", armedNumber, expirations, GetTimeNs() - start);
+}
+
+static void Benchmark_TimerApi(uint8_t armedPercent)
+{
+  uint8_t armedNumber = ArmTimers(armedPercent);
+  SFTM_TimerHandle_T timer = Timers[MAX_TIMER_SLOTS - 1];
+  uint64_t elapsed;
+  uint64_t start;
+
+  /* Timer has to be stopped before it can be started again, so start is measured with stop
+   * of running timer, calls are too short to be timed one by one */
+  SFTM_StopTimer(timer);
+  start = GetTimeNs();
+  for (uint32_t cnt = 0; cnt < BM_API_CALLS; cnt++)
+  {
+    SFTM_StartTimer(timer, SFTM_AUTO_RELOAD, BenchmarkCallback, NULL, BM_TIMER_TIMEOUT);
+    SFTM_StopTimer(timer);
+  }
+  elapsed = GetTimeNs() - start;
+  PrintResult("start_stop_timer", armedNumber, BM_API_CALLS, elapsed);
+
+  SFTM_StartTimer(timer, SFTM_AUTO_RELOAD, BenchmarkCallback, NULL, BM_TIMER_TIMEOUT);
+  start = GetTimeNs();
+  for (uint32_t cnt = 0; cnt < BM_API_CALLS; cnt++)
+  {
+    SFTM_RestartTimer(timer);
+  }
+  elapsed = GetTimeNs() - start;
+  PrintResult("restart_timer", armedNumber, BM_API_CALLS, elapsed);
+}
+
+/*======================================================================================*/
+/*                 ####### EXPORTED FUNCTIONS DEFINITIONS #######                       */
+/*======================================================================================*/
+int main(int argc, const char * argv[])
+{
+  if (argc > 1)
+  {
+    Label = argv[1];
+  }
+
+  for (uint8_t ratioCnt = 0; ratioCnt < sizeof(ArmedPercents) / sizeof(ArmedPercents[0]); ratioCnt++)
+  {
+    Benchmark_TimersHandler(ArmedPercents[ratioCnt]);
+    Benchmark_TimersEventsHandler(ArmedPercents[ratioCnt]);
+    Benchmark_Advance(ArmedPercents[ratioCnt]);
+    Benchmark_TimerApi(ArmedPercents[ratioCnt]);
+  }
+
+  return 0;
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,170 @@
+/*=======================================================================================*
+ * @file    BM_SoftTimersCpp.cpp
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains benchmarks of Soft Timers C++ wrapper.
+ *
+ *          Benchmarks run the same start/stop loop through C API with raw callback and
+ *          through sftm::Timer. Dispatch is measured as the call engine makes on expiry,
+ *          through callback pointer read from memory, for raw callback, for sftm::Timer
+ *          trampoline and for sftm::InlineTimer trampoline of lambda with captured state.
+ *          Each loop is repeated and the fastest repetition is reported, so results are
+ *          not disturbed by scheduler. Results are printed as one JSON object per line
+ *          with the same fields as C benchmarks. Wrapper has no overhead if its variants
+ *          take the same time as raw ones, its code size is checked by CompareCodeSize.cmake.
+ *          Optional first argument is a label copied to every result.
+ *======================================================================================*/
+
+/**
+ * @addtogroup Soft Timers Benchmarks
+ * @{
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "SoftTimers.hpp"
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+#define BM_API_CALLS                  200000     ///< API calls per latency benchmark repetition
+#define BM_DISPATCH_CALLS             10000000   ///< Callback calls per dispatch benchmark repetition
+#define BM_REPETITIONS                15         ///< Repetitions of each benchmark, fastest is reported
+
+/*======================================================================================*/
+/*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
+/*======================================================================================*/
+static uint64_t GetTimeNs(void);
+static void PrintResult(const char *name, uint32_t operations, uint64_t elapsedNs);
+static void RawCallback(void *pContext);
+static void WrappedCallback(void);
+static void MeasureDispatch(const char *name, SFTM_TimerCallback_T onExpire, void *pContext);
+static void Benchmark_StartStop(void);
+static void Benchmark_Dispatch(void);
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*---------------------------------- LOCAL OBJECTS -------------------------------------*/
+static volatile uint32_t CallbackSink = 0;                    ///< Prevents callback optimization
+static const char *Label = "";                                ///< Label printed with results
+
+using WrappedTimer = sftm::Timer<WrappedCallback>;
+
+static_assert(sizeof(WrappedTimer) == sizeof(SFTM_TimerHandle_T), "Wrapper has to keep timer handle only");
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+static uint64_t GetTimeNs(void)
+{
+  return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void PrintResult(const char *name, uint32_t operations, uint64_t elapsedNs)
+{
+  printf("{\"label\":\"%s\",\"benchmark\":\"%s\",\"slots\":%u,\"armed\":%u,\"operations\":%lu,\"ns_per_op\":%.2f}\n",
+         Label, name, (unsigned)SFTM_MaxTimersNumberInSystem(), 1u, (unsigned long)operations,
+         (operations != 0) ? (double)elapsedNs / operations : 0.0);
+}
+
+static void RawCallback(void *pContext)
+{
+  CallbackSink++;
+}
+
+static void WrappedCallback(void)
+{
+  CallbackSink++;
+}
+
+static void MeasureDispatch(const char *name, SFTM_TimerCallback_T onExpire, void *pContext)
+{
+  /* Engine reads callback from timer configuration, so pointer is not known to compiler */
+  SFTM_TimerCallback_T volatile pOnExpire = onExpire;
+  uint64_t bestNs = UINT64_MAX;
+
+  for (uint32_t repetitionCnt = 0; repetitionCnt < BM_REPETITIONS; repetitionCnt++)
+  {
+    uint64_t start = GetTimeNs();
+
+    for (uint32_t cnt = 0; cnt < BM_DISPATCH_CALLS; cnt++)
+    {
+      pOnExpire(pContext);
+    }
+    bestNs = std::min(bestNs, GetTimeNs() - start);
+  }
+  PrintResult(name, BM_DISPATCH_CALLS, bestNs);
+}
+
+static void Benchmark_StartStop(void)
+{
+  SFTM_TimerHandle_T rawTimer = SFTM_CreateTimer();
+  WrappedTimer wrappedTimer;
+  uint64_t rawBestNs = UINT64_MAX;
+  uint64_t wrapperBestNs = UINT64_MAX;
+
+  /* Variants are interleaved, so both see the same machine state */
+  for (uint32_t repetitionCnt = 0; repetitionCnt < BM_REPETITIONS; repetitionCnt++)
+  {
+    uint64_t start = GetTimeNs();
+
+    for (uint32_t cnt = 0; cnt < BM_API_CALLS; cnt++)
+    {
+      SFTM_StartTimer(rawTimer, SFTM_AUTO_RELOAD, RawCallback, NULL, 1000);
+      SFTM_StopTimer(rawTimer);
+    }
+    rawBestNs = std::min(rawBestNs, GetTimeNs() - start);
+
+    start = GetTimeNs();
+    for (uint32_t cnt = 0; cnt < BM_API_CALLS; cnt++)
+    {
+      wrappedTimer.Start(SFTM_AUTO_RELOAD, std::chrono::seconds(1));
+      wrappedTimer.Stop();
+    }
+    wrapperBestNs = std::min(wrapperBestNs, GetTimeNs() - start);
+  }
+  PrintResult("raw_start_stop", BM_API_CALLS, rawBestNs);
+  PrintResult("wrapper_start_stop", BM_API_CALLS, wrapperBestNs);
+
+  SFTM_DeleteTimer(rawTimer);
+}
+
+static void Benchmark_Dispatch(void)
+{
+  volatile uint32_t *pSink = &CallbackSink;
+  auto callable = [pSink]() { (*pSink)++; };
+
+  MeasureDispatch("raw_dispatch", RawCallback, NULL);
+  MeasureDispatch("wrapper_dispatch", sftm::detail::Call<WrappedCallback>, NULL);
+  /* Inline timer passes its copy of callable, stored in timer slot, as context */
+  MeasureDispatch("inline_dispatch", sftm::detail::CallInline<decltype(callable)>, &callable);
+}
+
+/*======================================================================================*/
+/*                 ####### EXPORTED FUNCTIONS DEFINITIONS #######                       */
+/*======================================================================================*/
+int main(int argc, const char * argv[])
+{
+  if (argc > 1)
+  {
+    Label = argv[1];
+  }
+
+  SFTM_Init();
+  Benchmark_StartStop();
+  Benchmark_Dispatch();
+
+  return 0;
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,53 @@
+/*=======================================================================================*
+ * @file    BM_SoftTimersCppSizeRaw.cpp
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains timer use through C API for code size comparison.
+ *
+ *          It is compiled to object file only, its code size is compared against
+ *          BM_SoftTimersCppSizeWrapper.cpp which does the same through sftm::Timer.
+ *======================================================================================*/
+
+/**
+ * @addtogroup Soft Timers Benchmarks
+ * @{
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+#include <cstdint>
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "SoftTimers.h"
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*--------------------------------- EXPORTED OBJECTS -----------------------------------*/
+extern volatile uint32_t CallbackSink;
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+static void RawCallback(void *pContext)
+{
+  CallbackSink++;
+}
+
+/*======================================================================================*/
+/*                 ####### EXPORTED FUNCTIONS DEFINITIONS #######                       */
+/*======================================================================================*/
+void BM_UseTimer(void)
+{
+  SFTM_TimerHandle_T timer = SFTM_CreateTimer();
+
+  SFTM_StartTimer(timer, SFTM_AUTO_RELOAD, RawCallback, NULL, 1000);
+  SFTM_StopTimer(timer);
+  SFTM_DeleteTimer(timer);
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,53 @@
+/*=======================================================================================*
+ * @file    BM_SoftTimersCppSizeWrapper.cpp
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains timer use through C++ wrapper for code size comparison.
+ *
+ *          It is compiled to object file only, its code size is compared against
+ *          BM_SoftTimersCppSizeRaw.cpp which does the same through C API.
+ *======================================================================================*/
+
+/**
+ * @addtogroup Soft Timers Benchmarks
+ * @{
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+#include <chrono>
+#include <cstdint>
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "SoftTimers.hpp"
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*--------------------------------- EXPORTED OBJECTS -----------------------------------*/
+extern volatile uint32_t CallbackSink;
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+static void WrappedCallback(void)
+{
+  CallbackSink++;
+}
+
+/*======================================================================================*/
+/*                 ####### EXPORTED FUNCTIONS DEFINITIONS #######                       */
+/*======================================================================================*/
+void BM_UseTimer(void)
+{
+  sftm::Timer<WrappedCallback> timer;
+
+  timer.Start(SFTM_AUTO_RELOAD, std::chrono::seconds(1));
+  timer.Stop();
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,190 @@
+/*=======================================================================================*
+ * @file    TraceDecoder.c
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains host tool which decodes Soft Timers trace dump.
+ *
+ *          Usage: TraceDecoder [dump.bin]
+ *          Dump is raw memory of SFTM_TraceBuffer_T, it is read from stdin if no file is
+ *          given. Records are printed as timeline from the oldest one. Dispatch begin
+ *          shows time elapsed since expiration of the same timer and dispatch end shows
+ *          callback duration.
+ *======================================================================================*/
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "SoftTimersTrace.h"
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+#define HEADER_SIZE                   20         ///< Size of trace buffer header in dump
+#define RECORD_SIZE                   8          ///< Size of trace record in dump
+#define MAX_TIMERS                    256        ///< Number of distinguishable timer indexes
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*---------------------------------- LOCAL OBJECTS -------------------------------------*/
+static const char * const EventNames[SFTM_TRACE_EVENTS_NUMBER] =
+{
+  [SFTM_TRACE_START]          = "START",
+  [SFTM_TRACE_STOP]           = "STOP",
+  [SFTM_TRACE_RESTART]        = "RESTART",
+  [SFTM_TRACE_EXPIRE]         = "EXPIRE",
+  [SFTM_TRACE_DISPATCH_BEGIN] = "DISPATCH_BEGIN",
+  [SFTM_TRACE_DISPATCH_END]   = "DISPATCH_END",
+};
+
+static double ExpireTimes[MAX_TIMERS];          ///< Last expiration time of each timer
+static double DispatchTimes[MAX_TIMERS];        ///< Last dispatch begin time of each timer
+
+/*======================================================================================*/
+/*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
+/*======================================================================================*/
+static uint32_t ReadU32(const uint8_t *pData);
+static uint16_t ReadU16(const uint8_t *pData);
+static uint8_t* ReadDump(FILE *pFile, size_t *pSize);
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+static uint32_t ReadU32(const uint8_t *pData)
+{
+  return (uint32_t)pData[0] | ((uint32_t)pData[1] << 8) | ((uint32_t)pData[2] << 16) | ((uint32_t)pData[3] << 24);
+}
+
+static uint16_t ReadU16(const uint8_t *pData)
+{
+  return (uint16_t)(pData[0] | (pData[1] << 8));
+}
+
+static uint8_t* ReadDump(FILE *pFile, size_t *pSize)
+{
+  size_t capacity = 4096;
+  size_t size = 0;
+  uint8_t *pData = malloc(capacity);
+
+  while (pData != NULL)
+  {
+    size += fread(pData + size, 1, capacity - size, pFile);
+
+    if (size < capacity)
+    {
+      break;
+    }
+
+    uint8_t *pResized = realloc(pData, capacity * 2);
+
+    if (NULL == pResized)
+    {
+      free(pData);
+    }
+    else { /* Do nothing */ }
+
+    pData = pResized;
+    capacity *= 2;
+  }
+
+  *pSize = size;
+
+  return pData;
+}
+
+/*======================================================================================*/
+/*                 ####### EXPORTED FUNCTIONS DEFINITIONS #######                       */
+/*======================================================================================*/
+int main(int argc, const char * argv[])
+{
+  FILE *pFile = (argc > 1) ? fopen(argv[1], "rb") : stdin;
+  uint8_t *pDump;
+  size_t dumpSize;
+
+  if (NULL == pFile)
+  {
+    fprintf(stderr, "Cannot open %s\n", argv[1]);
+    return EXIT_FAILURE;
+  }
+
+  pDump = ReadDump(pFile, &dumpSize);
+
+  if (NULL == pDump || dumpSize < HEADER_SIZE || ReadU32(&pDump[0]) != SFTM_TRACE_MAGIC)
+  {
+    fprintf(stderr, "Not a Soft Timers trace dump\n");
+    return EXIT_FAILURE;
+  }
+
+  uint16_t version         = ReadU16(&pDump[4]);
+  uint16_t recordsNumber   = ReadU16(&pDump[6]);
+  uint32_t timersClk       = ReadU32(&pDump[8]);
+  uint32_t subTicksPerTick = ReadU32(&pDump[12]);
+  uint32_t head            = ReadU32(&pDump[16]);
+
+  if (version != SFTM_TRACE_VERSION || 0 == timersClk || 0 == subTicksPerTick ||
+      dumpSize < HEADER_SIZE + (size_t)recordsNumber * RECORD_SIZE)
+  {
+    fprintf(stderr, "Unsupported or truncated trace dump\n");
+    return EXIT_FAILURE;
+  }
+
+  uint32_t validRecords = (head < recordsNumber) ? head : recordsNumber;
+  uint32_t firstRecord  = (head < recordsNumber) ? 0 : (head % recordsNumber);
+  double msPerTick      = 1000.0 / timersClk;
+  double previousTime   = 0.0;
+
+  printf("# Soft Timers trace v%u: %lu of %lu events, %lu Hz timers clock, %lu sub ticks per tick\n",
+         (unsigned)version, (unsigned long)validRecords, (unsigned long)head,
+         (unsigned long)timersClk, (unsigned long)subTicksPerTick);
+  printf("# %14s %12s  %-15s %5s  %s\n", "time [ms]", "delta [ms]", "event", "timer", "info");
+
+  for (uint32_t recordCnt = 0; recordCnt < validRecords; recordCnt++)
+  {
+    const uint8_t *pRecord = &pDump[HEADER_SIZE + ((firstRecord + recordCnt) % recordsNumber) * RECORD_SIZE];
+    uint32_t tick    = ReadU32(&pRecord[0]);
+    uint16_t subTick = ReadU16(&pRecord[4]);
+    uint8_t event    = pRecord[6];
+    uint8_t timerIdx = pRecord[7];
+    double time      = (tick + (double)subTick / subTicksPerTick) * msPerTick;
+
+    printf("  %14.3f %+12.3f  %-15s ", time, (0 == recordCnt) ? 0.0 : time - previousTime,
+           (event < SFTM_TRACE_EVENTS_NUMBER) ? EventNames[event] : "UNKNOWN");
+    if (SFTM_TRACE_NO_TIMER == timerIdx)
+    {
+      printf("%5s", "-");
+    }
+    else
+    {
+      printf("%5u", (unsigned)timerIdx);
+    }
+
+    switch (event)
+    {
+      case SFTM_TRACE_EXPIRE:
+        ExpireTimes[timerIdx] = time;
+        break;
+      case SFTM_TRACE_DISPATCH_BEGIN:
+        DispatchTimes[timerIdx] = time;
+        printf("  lateness %.3f ms", time - ExpireTimes[timerIdx]);
+        break;
+      case SFTM_TRACE_DISPATCH_END:
+        printf("  callback %.3f ms", time - DispatchTimes[timerIdx]);
+        break;
+      default:
+        break;
+    }
+    printf("\n");
+
+    previousTime = time;
+  }
+
+  free(pDump);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,25 @@
+/*=======================================================================================*
+ * @file    SoftTimersStatic.h
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   Static timers of Soft Timers unit tests
+ *
+ *          This file declares timers created at compile time when SFTM_CFG_STATIC_TIMERS
+ *          is enabled.
+ *======================================================================================*/
+/*----------------------- DEFINE TO PREVENT RECURSIVE INCLUSION ------------------------*/
+#ifndef SOFTTIMERSSTATIC_H_
+#define SOFTTIMERSSTATIC_H_
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+/** Static timers list, TIMER(name, timerType, timeout, onExpire, pContext) */
+#define SFTM_STATIC_TIMERS(TIMER)                                       \
+  TIMER(Blink,   SFTM_AUTO_RELOAD, 10, StaticTimerOnExpireFunction, NULL) \
+  TIMER(Timeout, SFTM_ONE_SHOT,    25, StaticTimerOnExpireFunction, NULL)
+
+/*======================================================================================*/
+/*                   ####### EXPORTED FUNCTIONS PROTOTYPES #######                      */
+/*======================================================================================*/
+void StaticTimerOnExpireFunction(void *pContext);
+
+#endif /* SOFTTIMERSSTATIC_H_ */
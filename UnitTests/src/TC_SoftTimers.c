@@ -15,6 +15,7 @@
 /*                       ####### PREPROCESSOR DIRECTIVES #######                        */
 /*======================================================================================*/
 /*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+#include <pthread.h>
 
 /*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
 #include "unity.h"
@@ -23,6 +24,7 @@
 #include "SoftTimers.c"
 
 /*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+#define CREATED_TIMER_SLOTS           (MAX_TIMER_SLOTS - SFTM_STATIC_TIMERS_NUMBER)   ///< Slots left for created timers
 
 /*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
 
@@ -43,11 +45,34 @@
 /*---------------------------------- LOCAL OBJECTS -------------------------------------*/
 TEST_GROUP(SoftTimers);
 static uint32_t OnExpireCallsNumber = 0;
+static uint32_t DispatchOrder[16];
+static uint32_t DispatchOrderNumber = 0;
+static SFTM_ticks ExpectedDeadlines[MAX_TIMER_SLOTS];
+static uint32_t DeadlineMissesNumber = 0;
+#if (SFTM_CFG_BATCH)
+static uint32_t BatchCallsNumber = 0;
+static uint32_t BatchContextsNumber = 0;
+#endif
+#if (SFTM_CFG_LATENESS)
+static uint32_t OnExpireLateness = 0;
+#endif
 
 /*======================================================================================*/
 /*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
 /*======================================================================================*/
 static void TimerOnExpireFunction(void *pContext);
+static void TimerOnExpireCountFunction(void *pContext);
+static void TimerOnExpireOrderFunction(void *pContext);
+static void TimerOnExpireDeadlineFunction(void *pContext);
+static void TimerOnExpireRearmFunction(void *pContext);
+static void TimerOnExpirePauseFunction(void *pContext);
+static void* RestartTimerThreadFunction(void *pTimer);
+#if (SFTM_CFG_BATCH)
+static void TimerOnExpireBatchFunction(void * const *ppContexts, uint8_t contextsNumber);
+#endif
+#if (SFTM_CFG_LATENESS)
+static void TimerOnExpireLatenessFunction(void *pContext);
+#endif
 
 /*======================================================================================*/
 /*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
@@ -57,14 +82,109 @@ static void TimerOnExpireFunction(void *pContext)
   OnExpireCallsNumber++;
 }
 
+static void TimerOnExpireCountFunction(void *pContext)
+{
+  (*(uint32_t*)pContext)++;
+}
+
+#if (SFTM_CFG_STATIC_TIMERS)
+void StaticTimerOnExpireFunction(void *pContext)
+{
+  OnExpireCallsNumber++;
+}
+#endif
+
+#if (SFTM_CFG_BATCH)
+static void TimerOnExpireBatchFunction(void * const *ppContexts, uint8_t contextsNumber)
+{
+  BatchCallsNumber++;
+
+  for (uint8_t contextCnt = 0; contextCnt < contextsNumber; contextCnt++)
+  {
+    /* Contexts come in expiration order */
+    TEST_ASSERT_EQUAL_UINT32(BatchContextsNumber++, *(uint32_t*)ppContexts[contextCnt]);
+  }
+}
+#endif
+
+static void* RestartTimerThreadFunction(void *pTimer)
+{
+  for (uint32_t restartCnt = 0; restartCnt < 10000; restartCnt++)
+  {
+    SFTM_RestartTimer((SFTM_TimerHandle_T)pTimer);
+  }
+
+  return NULL;
+}
+
+static void TimerOnExpireOrderFunction(void *pContext)
+{
+  if (DispatchOrderNumber < sizeof(DispatchOrder) / sizeof(DispatchOrder[0]))
+  {
+    DispatchOrder[DispatchOrderNumber++] = (uint32_t)(uintptr_t)pContext;
+  }
+}
+
+#if (SFTM_CFG_LATENESS)
+static void TimerOnExpireLatenessFunction(void *pContext)
+{
+  OnExpireCallsNumber++;
+  OnExpireLateness = SFTM_StatsGetDispatchLateness();
+}
+#endif
+
+static void TimerOnExpireDeadlineFunction(void *pContext)
+{
+  OnExpireCallsNumber++;
+
+  if (*(SFTM_ticks*)pContext != SFTM_GetSystemTick())
+  {
+    DeadlineMissesNumber++;
+  }
+}
+
+static void TimerOnExpireRearmFunction(void *pContext)
+{
+  SFTM_TimerHandle_T timerHandle = pContext;
+
+  OnExpireCallsNumber++;
+
+  /* First expiry starts own timer again and lets it expire before return, second one deletes it */
+  if (1 == OnExpireCallsNumber)
+  {
+    SFTM_StopTimer(timerHandle);
+    SFTM_StartTimer(timerHandle, SFTM_ONE_SHOT, TimerOnExpireRearmFunction, timerHandle, 1);
+    SFTM_Advance(1);
+  }
+  else
+  {
+    SFTM_DeleteTimer(timerHandle);
+  }
+}
+
+static void TimerOnExpirePauseFunction(void *pContext)
+{
+  OnExpireCallsNumber++;
+  SFTM_PauseTimer((SFTM_TimerHandle_T)pContext);
+}
+
 /*======================================================================================*/
 /*                        ####### TESTS DEFINITIONS #######                             */
 /*======================================================================================*/
 TEST_SETUP(SoftTimers)
 {
   SFTM_Init();
-  CurrentTimersNumber = 0;
+  CurrentTimersNumber = SFTM_STATIC_TIMERS_NUMBER;
+#if (SFTM_CFG_GROUPS)
+  CurrentGroupsNumber = 0;
+#endif
   OnExpireCallsNumber = 0;
+  DispatchOrderNumber = 0;
+  DeadlineMissesNumber = 0;
+#if (SFTM_CFG_BATCH)
+  BatchCallsNumber = 0;
+  BatchContextsNumber = 0;
+#endif
 }
 
 TEST_TEAR_DOWN(SoftTimers)
@@ -74,13 +194,15 @@ TEST_TEAR_DOWN(SoftTimers)
 
 TEST(SoftTimers, SFTM_Init_should_InitializeTimersSlotsProperly)
 {
-  for (uint8_t timerCnt = 0; timerCnt < MAX_TIMER_SLOTS; timerCnt++)
+  for (uint8_t timerCnt = SFTM_STATIC_TIMERS_NUMBER; timerCnt < MAX_TIMER_SLOTS; timerCnt++)
   {
-    TEST_ASSERT_EQUAL_UINT32(TIMIER_IDLE_VALUE, TimersArray[timerCnt].ticks);
-    TEST_ASSERT_EQUAL_UINT32(0, TimersArray[timerCnt].timeout);
-    TEST_ASSERT_FALSE(TimersArray[timerCnt].expiredFlag);
-    TEST_ASSERT_NULL(TimersArray[timerCnt].onExpire);
-    TEST_ASSERT_NULL(TimersArray[timerCnt].pContext);
+    TEST_ASSERT_EQUAL_UINT32(TIMIER_IDLE_VALUE, SFTM_GetTimerTick(&TimersArray[timerCnt]));
+    TEST_ASSERT_EQUAL_UINT32(0, GET_CONFIG(timerCnt)->timeout);
+    TEST_ASSERT_EQUAL_UINT8(SFTM_TIMER_IDLE, TimersArray[timerCnt].state);
+    TEST_ASSERT_EQUAL_UINT8(NOT_IN_HEAP, TimersArray[timerCnt].heapIdx);
+    TEST_ASSERT_FALSE(TimersArray[timerCnt].queued);
+    TEST_ASSERT_NULL(GET_ON_EXPIRE(timerCnt));
+    TEST_ASSERT_NULL(GET_CONTEXT(timerCnt));
   }
 }
 
@@ -121,15 +243,15 @@ TEST(SoftTimers, Timer_should_CallOnExpireWhenTimerReachesTimeoutOnLastTimerSlot
 {
   const uint32_t timeout = 10;
   uint32_t timersHandlerTicks = TICK_CMP * timeout;
-  SFTM_TimerHandle_T testedTimersArray[MAX_TIMER_SLOTS];
+  SFTM_TimerHandle_T testedTimersArray[CREATED_TIMER_SLOTS];
   SFTM_TimerHandle_T testedTimer;
 
-  for (uint8_t cnt = 0; cnt < MAX_TIMER_SLOTS; cnt++)
+  for (uint8_t cnt = 0; cnt < CREATED_TIMER_SLOTS; cnt++)
   {
     testedTimersArray[cnt] = SFTM_CreateTimer();
   }
 
-  testedTimer = testedTimersArray[MAX_TIMER_SLOTS - 1];
+  testedTimer = testedTimersArray[CREATED_TIMER_SLOTS - 1];
   SFTM_StartTimer(testedTimer, SFTM_ONE_SHOT, TimerOnExpireFunction, NULL, timeout);
   for (uint32_t cnt = 0; cnt < timersHandlerTicks; cnt++)
   {
@@ -156,23 +278,739 @@ TEST(SoftTimers, Timer_should_CallOnExpireEveryExpirationWhenItIsAutoreloaded)
   TEST_ASSERT_EQUAL_UINT32(periodNumber, OnExpireCallsNumber);
 }
 
-// TODO:
+#if (SFTM_CFG_INSTRUMENTATION)
+TEST(SoftTimers, Timer_should_RecordCallbackAndHandlerExecutionTime)
+{
+  const uint32_t timeout = 3;
+  const uint32_t periodNumber = 4;
+  uint32_t timersHandlerTicks = TICK_CMP * timeout * periodNumber;
+  SFTM_TimerHandle_T testedTimer;
+  SFTM_TimerHandle_T idleTimer;
+
+  /* Statistics are cleared by SFTM_Init in test setup */
+  testedTimer = SFTM_CreateTimer();
+  idleTimer = SFTM_CreateTimer();
+  SFTM_StartTimer(testedTimer, SFTM_AUTO_RELOAD, TimerOnExpireFunction, NULL, timeout);
+  for (uint32_t cnt = 0; cnt < timersHandlerTicks; cnt++)
+  {
+    SFTM_TimersHandler();
+    SFTM_TimersEventsHandler();
+  }
+  TEST_ASSERT_EQUAL_UINT32(periodNumber, SFTM_StatsGetCallbackHistogram(testedTimer)->samples);
+  TEST_ASSERT_EQUAL_UINT32(0, SFTM_StatsGetCallbackHistogram(idleTimer)->samples);
+  TEST_ASSERT_EQUAL_UINT32(timersHandlerTicks, SFTM_StatsGetTickHistogram()->samples);
+}
+#endif
+
+#if (SFTM_CFG_LATENESS)
+TEST(SoftTimers, Timer_should_RecordLatenessBetweenExpiryAndDispatch)
+{
+  const uint32_t timeout = 2;
+  const uint32_t lateness = 150;
+  uint32_t timersHandlerTicks = TICK_CMP * timeout;
+  SFTM_TimerHandle_T testedTimer;
+
+  /* Statistics are cleared by SFTM_Init in test setup */
+  testedTimer = SFTM_CreateTimer();
+  SFTM_StartTimer(testedTimer, SFTM_AUTO_RELOAD, TimerOnExpireLatenessFunction, NULL, timeout);
+  for (uint32_t periodCnt = 0; periodCnt < 2; periodCnt++)
+  {
+    for (uint32_t cnt = 0; cnt < timersHandlerTicks + lateness * periodCnt; cnt++)
+    {
+      SFTM_TimersHandler();
+    }
+    SFTM_TimersEventsHandler();
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(2, OnExpireCallsNumber);
+  TEST_ASSERT_EQUAL_UINT32(lateness, OnExpireLateness);
+  TEST_ASSERT_EQUAL_UINT32(2, SFTM_StatsGetLatenessHistogram(testedTimer)->samples);
+  TEST_ASSERT_EQUAL_UINT32(lateness, SFTM_StatsGetLatenessHistogram(testedTimer)->maxValue);
+  TEST_ASSERT_EQUAL_UINT32(lateness / 2, SFTM_StatsGetMean(SFTM_StatsGetGlobalLatenessHistogram()));
+}
+#endif
+
+#if (SFTM_CFG_TRACE)
+TEST(SoftTimers, Timer_should_TraceLifecycleEvents)
+{
+  const uint32_t timeout = 2;
+  uint32_t timersHandlerTicks = TICK_CMP * timeout;
+  const SFTM_TraceBuffer_T *pTrace = SFTM_TraceGetBuffer();
+  SFTM_TimerHandle_T testedTimer;
+  uint32_t startTick;
+
+  /* Trace is initialized by SFTM_Init in test setup */
+  SFTM_CreateTimer();
+  testedTimer = SFTM_CreateTimer();
+  startTick = SFTM_GetSystemTick();
+  SFTM_StartTimer(testedTimer, SFTM_ONE_SHOT, TimerOnExpireFunction, NULL, timeout);
+  for (uint32_t cnt = 0; cnt < timersHandlerTicks; cnt++)
+  {
+    SFTM_TimersHandler();
+    SFTM_TimersEventsHandler();
+  }
+  SFTM_StopTimer(testedTimer);
+
+  TEST_ASSERT_EQUAL_UINT32(SFTM_TRACE_MAGIC, pTrace->magic);
+  TEST_ASSERT_EQUAL_UINT32(5, pTrace->head);
+  TEST_ASSERT_EQUAL_UINT8(SFTM_TRACE_START, pTrace->records[0].event);
+  TEST_ASSERT_EQUAL_UINT8(SFTM_TRACE_EXPIRE, pTrace->records[1].event);
+  TEST_ASSERT_EQUAL_UINT8(SFTM_TRACE_DISPATCH_BEGIN, pTrace->records[2].event);
+  TEST_ASSERT_EQUAL_UINT8(SFTM_TRACE_DISPATCH_END, pTrace->records[3].event);
+  TEST_ASSERT_EQUAL_UINT8(SFTM_TRACE_STOP, pTrace->records[4].event);
+  TEST_ASSERT_EQUAL_UINT8(1, pTrace->records[1].timerIdx);
+  TEST_ASSERT_EQUAL_UINT32(startTick + timeout, pTrace->records[1].tick);
+}
+#endif
+
 TEST(SoftTimers, Timer_should_OperateIndependently)
 {
-//  const uint32_t timeout = 8;
-//  const uint32_t periodNumber = 2000;
-//  uint32_t timersHandlerTicks = TICK_CMP * timeout * periodNumber;
-//  SFTM_TimerHandle_T testedTimer;
-//
-//  testedTimer = SFTM_CreateTimer();
-//  SFTM_StartTimer(testedTimer, SFTM_AUTO_RELOAD, TimerOnExpireFunction, timeout);
-//  for (uint32_t cnt = 0; cnt < timersHandlerTicks; cnt++)
-//  {
-//    SFTM_TimersHandler();
-//    SFTM_TimersEventsHandler();
-//  }
-//  TEST_ASSERT_EQUAL_UINT32(periodNumber, OnExpireCallsNumber);
+  const uint32_t timeouts[] = { 8, 3, 5, 1000 };
+  const uint32_t advanceTicks = 16000;
+  uint32_t callsNumbers[sizeof(timeouts) / sizeof(timeouts[0])] = { 0 };
+  SFTM_TimerHandle_T testedTimers[sizeof(timeouts) / sizeof(timeouts[0])];
+
+  for (uint8_t timerCnt = 0; timerCnt < sizeof(timeouts) / sizeof(timeouts[0]); timerCnt++)
+  {
+    testedTimers[timerCnt] = SFTM_CreateTimer();
+    SFTM_StartTimer(testedTimers[timerCnt], SFTM_AUTO_RELOAD, TimerOnExpireCountFunction, &callsNumbers[timerCnt], timeouts[timerCnt]);
+  }
+  SFTM_StopTimer(testedTimers[1]);
+
+  SFTM_Advance(advanceTicks);
+
+  TEST_ASSERT_EQUAL_UINT32(advanceTicks / timeouts[0], callsNumbers[0]);
+  TEST_ASSERT_EQUAL_UINT32(0, callsNumbers[1]);
+  TEST_ASSERT_EQUAL_UINT32(advanceTicks / timeouts[2], callsNumbers[2]);
+  TEST_ASSERT_EQUAL_UINT32(advanceTicks / timeouts[3], callsNumbers[3]);
+}
+
+TEST(SoftTimers, Advance_should_CallOnExpireEveryExpirationWhenItIsAutoreloaded)
+{
+  const uint32_t timeout = 8;
+  const uint32_t periodNumber = 2000;
+  SFTM_TimerHandle_T testedTimer;
+  SFTM_ticks startTick = SFTM_GetSystemTick();
+
+  testedTimer = SFTM_CreateTimer();
+  SFTM_StartTimer(testedTimer, SFTM_AUTO_RELOAD, TimerOnExpireFunction, NULL, timeout);
+  SFTM_Advance(timeout * periodNumber + timeout - 1);
+
+  TEST_ASSERT_EQUAL_UINT32(periodNumber, OnExpireCallsNumber);
+  TEST_ASSERT_EQUAL_UINT32(startTick + timeout * periodNumber + timeout - 1, SFTM_GetSystemTick());
+  TEST_ASSERT_EQUAL_UINT32(timeout - 1, SFTM_GetTimerTick(testedTimer));
+}
+
+TEST(SoftTimers, Advance_should_DispatchTimersInDeadlineOrder)
+{
+  const uint32_t timeouts[] = { 30, 7, 20, 11 };
+  const uint32_t expectedOrder[] = { 1, 3, 1, 2, 1, 3, 1, 0 };
+  SFTM_TimerHandle_T testedTimer;
+
+  for (uint8_t timerCnt = 0; timerCnt < sizeof(timeouts) / sizeof(timeouts[0]); timerCnt++)
+  {
+    testedTimer = SFTM_CreateTimer();
+    SFTM_StartTimer(testedTimer, (0 == timerCnt % 2) ? SFTM_ONE_SHOT : SFTM_AUTO_RELOAD,
+                    TimerOnExpireOrderFunction, (void*)(uintptr_t)timerCnt, timeouts[timerCnt]);
+  }
+  SFTM_Advance(15);
+  TEST_ASSERT_EQUAL_UINT32(3, DispatchOrderNumber);
+  SFTM_Advance(15);
+
+  TEST_ASSERT_EQUAL_UINT32(sizeof(expectedOrder) / sizeof(expectedOrder[0]), DispatchOrderNumber);
+  TEST_ASSERT_EQUAL_UINT32_ARRAY(expectedOrder, DispatchOrder, DispatchOrderNumber);
+}
+
+TEST(SoftTimers, Advance_should_ExpireEveryTimerExactlyOnItsDeadline)
+{
+  SFTM_TimerHandle_T testedTimers[CREATED_TIMER_SLOTS];
+  uint32_t random = 12345;
+
+  for (uint8_t timerCnt = 0; timerCnt < CREATED_TIMER_SLOTS; timerCnt++)
+  {
+    testedTimers[timerCnt] = SFTM_CreateTimer();
+  }
+
+  for (uint32_t stepCnt = 0; stepCnt < 2000; stepCnt++)
+  {
+    random = random * 1103515245 + 12345;
+    uint8_t timerIdx = (uint8_t)((random >> 16) % CREATED_TIMER_SLOTS);
+    SFTM_timeoutMS timeout = 1 + (random >> 8) % 50;
+
+    SFTM_StopTimer(testedTimers[timerIdx]);
+    if ((random >> 24) % 4 != 0)
+    {
+      ExpectedDeadlines[timerIdx] = SFTM_GetSystemTick() + timeout;
+      SFTM_StartTimer(testedTimers[timerIdx], SFTM_ONE_SHOT, TimerOnExpireDeadlineFunction, &ExpectedDeadlines[timerIdx], timeout);
+    }
+    else { /* Leave timer stopped */ }
+    SFTM_Advance((random >> 4) % 7);
+  }
+  SFTM_Advance(100);
+
+  TEST_ASSERT_EQUAL_UINT32(0, DeadlineMissesNumber);
+  TEST_ASSERT_NOT_EQUAL(0, OnExpireCallsNumber);
+}
+
+TEST(SoftTimers, Advance_should_NotDispatchStoppedTimer)
+{
+  const uint32_t timeout = 5;
+  SFTM_TimerHandle_T testedTimer;
+
+  testedTimer = SFTM_CreateTimer();
+  SFTM_StartTimer(testedTimer, SFTM_ONE_SHOT, TimerOnExpireFunction, NULL, timeout);
+  for (uint32_t cnt = 0; cnt < TICK_CMP * timeout; cnt++)
+  {
+    SFTM_TimersHandler();
+  }
+  TEST_ASSERT_EQUAL(SFTM_EXPIRED, SFTM_GetTimerStatus(testedTimer));
+  SFTM_StopTimer(testedTimer);
+  SFTM_Advance(timeout);
+
+  TEST_ASSERT_EQUAL_UINT32(0, OnExpireCallsNumber);
+  TEST_ASSERT_EQUAL(SFTM_TIMER_STARTED, SFTM_StartTimer(testedTimer, SFTM_ONE_SHOT, TimerOnExpireFunction, NULL, timeout));
+  TEST_ASSERT_EQUAL(SFTM_NOT_EXPIRED, SFTM_GetTimerStatus(testedTimer));
+}
+
+TEST(SoftTimers, CreateTimer_should_InitializeSlotItHandsOut)
+{
+  SFTM_TimerHandle_T runningTimer = SFTM_CreateTimer();
+  SFTM_TimerHandle_T testedTimer;
+
+  SFTM_StartTimer(runningTimer, SFTM_ONE_SHOT, TimerOnExpireFunction, NULL, 5);
+
+  /* Slot never initialized by SFTM_Init is zero filled */
+  TimersArray[CurrentTimersNumber].heapIdx = 0;
+  testedTimer = SFTM_CreateTimer();
+  TEST_ASSERT_EQUAL_UINT8(NOT_IN_HEAP, testedTimer->heapIdx);
+
+  SFTM_StopTimer(testedTimer);
+  TEST_ASSERT_EQUAL_UINT8(1, TimersHeapSize);
+  SFTM_Advance(5);
+  TEST_ASSERT_EQUAL_UINT32(1, OnExpireCallsNumber);
+}
+
+TEST(SoftTimers, DeleteTimer_should_ReleaseSlotForNextCreatedTimer)
+{
+  const uint32_t timeout = 5;
+  SFTM_TimerHandle_T testedTimers[CREATED_TIMER_SLOTS];
+
+  for (uint8_t timerCnt = 0; timerCnt < CREATED_TIMER_SLOTS; timerCnt++)
+  {
+    testedTimers[timerCnt] = SFTM_CreateTimer();
+  }
+  SFTM_StartTimer(testedTimers[1], SFTM_ONE_SHOT, TimerOnExpireFunction, NULL, timeout);
+  SFTM_DeleteTimer(testedTimers[1]);
+  SFTM_Advance(timeout);
+
+  TEST_ASSERT_EQUAL_UINT32(0, OnExpireCallsNumber);
+  TEST_ASSERT_EQUAL(SFTM_TIMER_IN_USE, SFTM_StartTimer(testedTimers[1], SFTM_ONE_SHOT, TimerOnExpireFunction, NULL, timeout));
+  TEST_ASSERT_EQUAL_PTR(testedTimers[1], SFTM_CreateTimer());
+  TEST_ASSERT_EQUAL(SFTM_TIMER_STARTED, SFTM_StartTimer(testedTimers[1], SFTM_ONE_SHOT, TimerOnExpireFunction, NULL, timeout));
+}
+
+TEST(SoftTimers, Dispatch_should_KeepChangesMadeByCallbackToItsOwnTimer)
+{
+  const uint32_t timeout = 5;
+  SFTM_TimerHandle_T testedTimer;
+
+  testedTimer = SFTM_CreateTimer();
+  SFTM_StartTimer(testedTimer, SFTM_ONE_SHOT, TimerOnExpireRearmFunction, testedTimer, timeout);
+  SFTM_Advance(timeout);
+
+  TEST_ASSERT_EQUAL_UINT32(2, OnExpireCallsNumber);
+  TEST_ASSERT_EQUAL(SFTM_TIMER_FREE, testedTimer->state);
+}
+
+TEST(SoftTimers, Advance_should_ExpireFarFutureTimerExactlyOnItsDeadline)
+{
+  const SFTM_timeoutMS timeout = 0xF0000000;
+  SFTM_TimerHandle_T testedTimer;
+  uint64_t startTick = SFTM_GetSystemTick64();
+
+  testedTimer = SFTM_CreateTimer();
+  ExpectedDeadlines[0] = SFTM_GetSystemTick() + timeout;
+  SFTM_StartTimer(testedTimer, SFTM_ONE_SHOT, TimerOnExpireDeadlineFunction, &ExpectedDeadlines[0], timeout);
+
+  SFTM_Advance(timeout - 1);
+  TEST_ASSERT_EQUAL_UINT32(0, OnExpireCallsNumber);
+  TEST_ASSERT_EQUAL_UINT32(timeout - 1, SFTM_GetTimerTick(testedTimer));
+
+  SFTM_Advance(1);
+  TEST_ASSERT_EQUAL_UINT32(1, OnExpireCallsNumber);
+  TEST_ASSERT_EQUAL_UINT32(0, DeadlineMissesNumber);
+
+  SFTM_Advance(timeout);
+  TEST_ASSERT_EQUAL_UINT64(startTick + 2 * (uint64_t)timeout, SFTM_GetSystemTick64());
+}
+
+TEST(SoftTimers, PauseTimer_should_FreezeRemainingTimeOutsideOfRunningTimers)
+{
+  const uint32_t timeout = 10;
+  SFTM_TimerHandle_T testedTimer;
+
+  testedTimer = SFTM_CreateTimer();
+  SFTM_StartTimer(testedTimer, SFTM_AUTO_RELOAD, TimerOnExpireFunction, NULL, timeout);
+  SFTM_Advance(3);
+
+  SFTM_PauseTimer(testedTimer);
+  TEST_ASSERT_EQUAL_UINT8(0, TimersHeapSize);
+  SFTM_Advance(100);
+  TEST_ASSERT_EQUAL_UINT32(0, OnExpireCallsNumber);
+  TEST_ASSERT_EQUAL(SFTM_NOT_EXPIRED, SFTM_GetTimerStatus(testedTimer));
+  TEST_ASSERT_EQUAL_UINT32(3, SFTM_GetTimerTick(testedTimer));
+
+  SFTM_ResumeTimer(testedTimer);
+  SFTM_Advance(timeout - 3 - 1);
+  TEST_ASSERT_EQUAL_UINT32(0, OnExpireCallsNumber);
+  SFTM_Advance(1);
+  TEST_ASSERT_EQUAL_UINT32(1, OnExpireCallsNumber);
+  SFTM_Advance(timeout);
+  TEST_ASSERT_EQUAL_UINT32(2, OnExpireCallsNumber);
+}
+
+TEST(SoftTimers, PauseTimer_should_KeepAutoReloadTimerPausedFromItsCallback)
+{
+  const uint32_t timeout = 10;
+  SFTM_TimerHandle_T testedTimer;
+
+  testedTimer = SFTM_CreateTimer();
+  SFTM_StartTimer(testedTimer, SFTM_AUTO_RELOAD, TimerOnExpirePauseFunction, testedTimer, timeout);
+  SFTM_Advance(timeout);
+  TEST_ASSERT_EQUAL_UINT32(1, OnExpireCallsNumber);
+  TEST_ASSERT_EQUAL(SFTM_TIMER_PAUSED, testedTimer->state);
+
+  SFTM_Advance(3 * timeout);
+  TEST_ASSERT_EQUAL_UINT32(1, OnExpireCallsNumber);
+  TEST_ASSERT_EQUAL(SFTM_TIMER_PAUSED, testedTimer->state);
+
+  /* Resumed timer has its full timeout */
+  SFTM_ResumeTimer(testedTimer);
+  SFTM_Advance(timeout - 1);
+  TEST_ASSERT_EQUAL_UINT32(1, OnExpireCallsNumber);
+  SFTM_Advance(1);
+  TEST_ASSERT_EQUAL_UINT32(2, OnExpireCallsNumber);
+}
+
+TEST(SoftTimers, GetTicksUntilNextExpiry_should_ReturnTicksToEarliestDeadline)
+{
+  SFTM_TimerHandle_T longTimer = SFTM_CreateTimer();
+  SFTM_TimerHandle_T shortTimer = SFTM_CreateTimer();
+
+  TEST_ASSERT_EQUAL_UINT32(SFTM_NO_EXPIRY, SFTM_GetTicksUntilNextExpiry());
+
+  SFTM_StartTimer(longTimer, SFTM_ONE_SHOT, TimerOnExpireFunction, NULL, 30);
+  SFTM_StartTimer(shortTimer, SFTM_ONE_SHOT, TimerOnExpireFunction, NULL, 7);
+  TEST_ASSERT_EQUAL_UINT32(7, SFTM_GetTicksUntilNextExpiry());
+
+  SFTM_Advance(3);
+  TEST_ASSERT_EQUAL_UINT32(4, SFTM_GetTicksUntilNextExpiry());
+
+  for (uint32_t cnt = 0; cnt < TICK_CMP * 4; cnt++)
+  {
+    SFTM_TimersHandler();
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, SFTM_GetTicksUntilNextExpiry());
+
+  SFTM_TimersEventsHandler();
+  TEST_ASSERT_EQUAL_UINT32(23, SFTM_GetTicksUntilNextExpiry());
+}
+
+TEST(SoftTimers, IdleSleep_should_SleepUntilEarliestDeadline)
+{
+  SFTM_TimerHandle_T timer = SFTM_CreateTimer();
+
+  SFTM_StartTimer(timer, SFTM_ONE_SHOT, TimerOnExpireFunction, NULL, 5);
+  TEST_ASSERT_EQUAL_UINT32(5, SFTM_IdleSleep());
+  TEST_ASSERT_EQUAL_UINT32(0, SFTM_IdleSleep());
+
+  SFTM_TimersEventsHandler();
+  TEST_ASSERT_EQUAL_UINT32(1, OnExpireCallsNumber);
+}
+
+TEST(SoftTimers, PortTick_should_ExpireTimerWhileOtherThreadRestartsTimers)
+{
+  SFTM_TimerHandle_T testedTimer = SFTM_CreateTimer();
+  SFTM_TimerHandle_T restartedTimer = SFTM_CreateTimer();
+  uint32_t restartedCallsNumber = 0;
+  pthread_t restartThread;
+
+  SFTM_StartTimer(restartedTimer, SFTM_ONE_SHOT, TimerOnExpireCountFunction, &restartedCallsNumber, 1000);
+  SFTM_PortStartTick();
+  SFTM_StartTimer(testedTimer, SFTM_ONE_SHOT, TimerOnExpireFunction, NULL, 10);
+  TEST_ASSERT_EQUAL(0, pthread_create(&restartThread, NULL, RestartTimerThreadFunction, restartedTimer));
+  while (0 == OnExpireCallsNumber)
+  {
+    SFTM_PortWaitEvents();
+    SFTM_TimersEventsHandler();
+  }
+  pthread_join(restartThread, NULL);
+  SFTM_PortStopTick();
+  while (BaseTicks != 0)
+  {
+    /* Leave time on timers tick boundary for following tests */
+    SFTM_TimersHandler();
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(1, OnExpireCallsNumber);
+  TEST_ASSERT_EQUAL_UINT32(0, restartedCallsNumber);
+  TEST_ASSERT_EQUAL(SFTM_EXPIRED, SFTM_GetTimerStatus(testedTimer));
+  TEST_ASSERT_EQUAL(SFTM_NOT_EXPIRED, SFTM_GetTimerStatus(restartedTimer));
+  TEST_ASSERT_EQUAL_UINT8(1, TimersHeapSize);
+}
+
+#if (SFTM_CFG_GROUPS)
+TEST(SoftTimers, Group_should_StopAllMembersWithSingleCall)
+{
+  const uint32_t timeout = 10;
+  SFTM_TimerGroupHandle_T group = SFTM_CreateGroup();
+  uint32_t callsNumbers[4] = { 0 };
+  SFTM_TimerHandle_T testedTimers[4];
+
+  for (uint8_t timerCnt = 0; timerCnt < 4; timerCnt++)
+  {
+    testedTimers[timerCnt] = SFTM_CreateTimer();
+    SFTM_AddTimerToGroup(testedTimers[timerCnt], (timerCnt != 0) ? group : NULL);
+    SFTM_StartTimer(testedTimers[timerCnt], SFTM_AUTO_RELOAD, TimerOnExpireCountFunction, &callsNumbers[timerCnt], timeout);
+  }
+  SFTM_Advance(timeout);
+  SFTM_StopGroup(group);
+  SFTM_Advance(10 * timeout);
+
+  TEST_ASSERT_EQUAL_UINT32(11, callsNumbers[0]);
+  for (uint8_t timerCnt = 1; timerCnt < 4; timerCnt++)
+  {
+    TEST_ASSERT_EQUAL_UINT32(1, callsNumbers[timerCnt]);
+    TEST_ASSERT_EQUAL(SFTM_EXPIRED, SFTM_GetTimerStatus(testedTimers[timerCnt]));
+  }
+  TEST_ASSERT_EQUAL(SFTM_TIMER_STARTED, SFTM_StartTimer(testedTimers[1], SFTM_ONE_SHOT, TimerOnExpireCountFunction, &callsNumbers[1], timeout));
+  SFTM_Advance(timeout);
+  TEST_ASSERT_EQUAL_UINT32(2, callsNumbers[1]);
+}
+
+TEST(SoftTimers, Group_should_PauseAndResumeMembersKeepingRemainingTime)
+{
+  const uint32_t timeout = 10;
+  SFTM_TimerGroupHandle_T group = SFTM_CreateGroup();
+  SFTM_TimerHandle_T runningTimer = SFTM_CreateTimer();
+  SFTM_TimerHandle_T startedInPauseTimer = SFTM_CreateTimer();
+
+  SFTM_AddTimerToGroup(runningTimer, group);
+  SFTM_AddTimerToGroup(startedInPauseTimer, group);
+  SFTM_StartTimer(runningTimer, SFTM_ONE_SHOT, TimerOnExpireFunction, NULL, timeout);
+  SFTM_Advance(4);
+
+  SFTM_PauseGroup(group);
+  SFTM_StartTimer(startedInPauseTimer, SFTM_ONE_SHOT, TimerOnExpireFunction, NULL, timeout);
+  SFTM_Advance(50);
+  TEST_ASSERT_EQUAL_UINT32(0, OnExpireCallsNumber);
+  TEST_ASSERT_EQUAL(SFTM_NOT_EXPIRED, SFTM_GetTimerStatus(runningTimer));
+  TEST_ASSERT_EQUAL_UINT32(4, SFTM_GetTimerTick(runningTimer));
+  TEST_ASSERT_EQUAL_UINT32(0, SFTM_GetTimerTick(startedInPauseTimer));
+
+  SFTM_ResumeGroup(group);
+  SFTM_Advance(timeout - 4 - 1);
+  TEST_ASSERT_EQUAL_UINT32(0, OnExpireCallsNumber);
+  SFTM_Advance(1);
+  TEST_ASSERT_EQUAL_UINT32(1, OnExpireCallsNumber);
+  SFTM_Advance(4);
+  TEST_ASSERT_EQUAL_UINT32(2, OnExpireCallsNumber);
+}
+
+TEST(SoftTimers, Group_should_PostponeMembersWhenShifted)
+{
+  const uint32_t timeout = 10;
+  SFTM_TimerGroupHandle_T group = SFTM_CreateGroup();
+  SFTM_TimerHandle_T testedTimer = SFTM_CreateTimer();
+
+  SFTM_AddTimerToGroup(testedTimer, group);
+  SFTM_StartTimer(testedTimer, SFTM_AUTO_RELOAD, TimerOnExpireFunction, NULL, timeout);
+  SFTM_ShiftGroup(group, 5);
+
+  SFTM_Advance(timeout + 5 - 1);
+  TEST_ASSERT_EQUAL_UINT32(0, OnExpireCallsNumber);
+  TEST_ASSERT_EQUAL_UINT32(timeout - 1, SFTM_GetTimerTick(testedTimer));
+  SFTM_Advance(1);
+  TEST_ASSERT_EQUAL_UINT32(1, OnExpireCallsNumber);
+  SFTM_Advance(timeout);
+  TEST_ASSERT_EQUAL_UINT32(2, OnExpireCallsNumber);
+}
+#endif
+
+#if (SFTM_CFG_STATIC_TIMERS)
+TEST(SoftTimers, StaticTimer_should_BeConfiguredWithoutCreateCall)
+{
+  SFTM_TimerHandle_T blinkTimer = SFTM_STATIC_TIMER(Blink);
+
+  TEST_ASSERT_EQUAL_UINT8(SFTM_STATIC_TIMER_Blink, SFTM_GetTimerIndex(blinkTimer));
+  TEST_ASSERT_EQUAL_UINT32(10, GET_CONFIG(SFTM_STATIC_TIMER_Blink)->timeout);
+  TEST_ASSERT_EQUAL(SFTM_TIMER_IDLE, blinkTimer->state);
+
+  TEST_ASSERT_EQUAL(SFTM_TIMER_STARTED, SFTM_StartStaticTimer(blinkTimer));
+  TEST_ASSERT_EQUAL(SFTM_TIMER_STARTED, SFTM_StartStaticTimer(SFTM_STATIC_TIMER(Timeout)));
+  SFTM_Advance(30);
+  TEST_ASSERT_EQUAL_UINT32(3 + 1, OnExpireCallsNumber);
+
+#if (SFTM_CFG_ROM_DESCRIPTORS)
+  /* Only deadline and state bits are left in RAM */
+  TEST_ASSERT_TRUE(sizeof(SFTM_Timer_T) <= 8);
+#endif
+}
+#endif
+
+#if (SFTM_CFG_COMPACT)
+TEST(SoftTimers, Compact_should_ExpireOnDeadlineAcrossLowHalfWraparound)
+{
+  const SFTM_timeoutMS period = 0x20;
+  uint32_t expirationsNumber = 0;
+  SFTM_TimerHandle_T reloadTimer = SFTM_CreateTimer();
+  SFTM_TimerHandle_T longTimer = SFTM_CreateTimer();
+
+  /* Stored low half of deadline wraps around before system tick does */
+  SFTM_Advance(0x10000 - (SFTM_GetSystemTick() & 0xFFFF) - period / 2);
+  SFTM_StartTimer(reloadTimer, SFTM_AUTO_RELOAD, TimerOnExpireCountFunction, &expirationsNumber, period);
+  SFTM_StartTimer(longTimer, SFTM_ONE_SHOT, TimerOnExpireCountFunction, &expirationsNumber, SFTM_COMPACT_MAX_TIMEOUT);
+  TEST_ASSERT_EQUAL_UINT8(reloadTimer->callbackId, longTimer->callbackId);
+
+  SFTM_Advance(period - 1);
+  TEST_ASSERT_EQUAL_UINT32(0, expirationsNumber);
+  SFTM_Advance(1);
+  TEST_ASSERT_EQUAL_UINT32(1, expirationsNumber);
+
+  SFTM_Advance(SFTM_COMPACT_MAX_TIMEOUT - period);
+  TEST_ASSERT_EQUAL_UINT32(SFTM_COMPACT_MAX_TIMEOUT / period + 1, expirationsNumber);
+  TEST_ASSERT_EQUAL(SFTM_EXPIRED, SFTM_GetTimerStatus(longTimer));
+
+#if !(SFTM_CFG_EVENT_QUEUE)
+  TEST_ASSERT_TRUE(sizeof(SFTM_Timer_T) <= 8);
+#endif
+}
+
+TEST(SoftTimers, Compact_should_ReuseCallbacksTableEntriesOfStoppedTimers)
+{
+  uint32_t expirationsNumbers[2 * MAX_COMPACT_CALLBACKS] = { 0 };
+  SFTM_TimerHandle_T testedTimers[MAX_COMPACT_CALLBACKS];
+
+  /* Each timer holds its own entry until table is full */
+  for (uint8_t timerCnt = 0; timerCnt < MAX_COMPACT_CALLBACKS; timerCnt++)
+  {
+    testedTimers[timerCnt] = SFTM_CreateTimer();
+    SFTM_StartTimer(testedTimers[timerCnt], SFTM_ONE_SHOT, TimerOnExpireCountFunction, &expirationsNumbers[timerCnt], 10);
+  }
+
+  /* Pairs used over time exceed table size, entry of stopped timer is reused */
+  for (uint8_t contextCnt = MAX_COMPACT_CALLBACKS; contextCnt < 2 * MAX_COMPACT_CALLBACKS; contextCnt++)
+  {
+    SFTM_StopTimer(testedTimers[0]);
+    SFTM_StartTimer(testedTimers[0], SFTM_ONE_SHOT, TimerOnExpireCountFunction, &expirationsNumbers[contextCnt], 10);
+  }
+
+  /* Entry shared by two timers is kept until both are stopped */
+  SFTM_StopTimer(testedTimers[1]);
+  SFTM_StartTimer(testedTimers[1], SFTM_ONE_SHOT, TimerOnExpireCountFunction, &expirationsNumbers[2 * MAX_COMPACT_CALLBACKS - 1], 10);
+  TEST_ASSERT_EQUAL_UINT8(testedTimers[0]->callbackId, testedTimers[1]->callbackId);
+  SFTM_StopTimer(testedTimers[0]);
+  SFTM_StopTimer(testedTimers[2]);
+  SFTM_StartTimer(testedTimers[2], SFTM_ONE_SHOT, TimerOnExpireCountFunction, &expirationsNumbers[0], 10);
+  TEST_ASSERT_NOT_EQUAL(testedTimers[1]->callbackId, testedTimers[2]->callbackId);
+
+  SFTM_Advance(10);
+  TEST_ASSERT_EQUAL_UINT32(1, expirationsNumbers[0]);
+  TEST_ASSERT_EQUAL_UINT32(0, expirationsNumbers[2]);
+  TEST_ASSERT_EQUAL_UINT32(1, expirationsNumbers[2 * MAX_COMPACT_CALLBACKS - 1]);
+  for (uint8_t timerCnt = 3; timerCnt < MAX_COMPACT_CALLBACKS; timerCnt++)
+  {
+    TEST_ASSERT_EQUAL_UINT32(1, expirationsNumbers[timerCnt]);
+  }
+}
+#endif
+
+#if (SFTM_CFG_INLINE_CONTEXT)
+TEST(SoftTimers, InlineContext_should_PassCopyStoredInTimerToCallback)
+{
+  const uint32_t timeout = 5;
+  SFTM_TimerHandle_T testedTimer = SFTM_CreateTimer();
+  SFTM_ticks expectedDeadline = SFTM_GetSystemTick() + timeout;
+
+  SFTM_StartTimerInline(testedTimer, SFTM_ONE_SHOT, TimerOnExpireDeadlineFunction, &expectedDeadline, sizeof(expectedDeadline), timeout);
+  expectedDeadline = 0;
+  TEST_ASSERT_EQUAL_PTR(testedTimer->inlineContext.bytes, GET_CONTEXT(SFTM_GetTimerIndex(testedTimer)));
+
+  SFTM_Advance(timeout);
+  TEST_ASSERT_EQUAL_UINT32(1, OnExpireCallsNumber);
+  TEST_ASSERT_EQUAL_UINT32(0, DeadlineMissesNumber);
+  TEST_ASSERT_EQUAL(SFTM_TIMER_IN_USE, SFTM_StartTimerInline(testedTimer, SFTM_ONE_SHOT, TimerOnExpireDeadlineFunction,
+                                                             &expectedDeadline, sizeof(expectedDeadline), timeout));
+}
+#endif
+
+#if (SFTM_CFG_COMMAND_QUEUE)
+TEST(SoftTimers, CommandQueue_should_ApplyPostedCommandsInOrderAtNextHandlerCall)
+{
+  const uint32_t timeout = 5;
+  SFTM_TimerHandle_T testedTimer = SFTM_CreateTimer();
+
+  TEST_ASSERT_TRUE(SFTM_PostStartTimer(testedTimer, SFTM_ONE_SHOT, TimerOnExpireFunction, NULL, timeout));
+  TEST_ASSERT_EQUAL(SFTM_TIMER_IDLE, testedTimer->state);
+  SFTM_TimersHandler();
+  TEST_ASSERT_EQUAL(SFTM_TIMER_RUNNING, testedTimer->state);
+  for (uint32_t cnt = 1; cnt < TICK_CMP; cnt++)
+  {
+    SFTM_TimersHandler();
+  }
+
+  for (uint32_t commandCnt = 0; commandCnt < SFTM_COMMAND_QUEUE_SIZE / 2; commandCnt++)
+  {
+    TEST_ASSERT_TRUE(SFTM_PostStopTimer(testedTimer));
+    TEST_ASSERT_TRUE(SFTM_PostStartTimer(testedTimer, SFTM_ONE_SHOT, TimerOnExpireFunction, NULL, timeout));
+  }
+  TEST_ASSERT_FALSE(SFTM_PostRestartTimer(testedTimer));
+
+  SFTM_Advance(timeout);
+  TEST_ASSERT_EQUAL_UINT32(1, OnExpireCallsNumber);
+  TEST_ASSERT_TRUE(SFTM_PostRestartTimer(testedTimer));
+}
+#endif
+
+#if (SFTM_CFG_SUBTICK)
+TEST(SoftTimers, SubTick_should_CountSystemTickIsrCallsWithinTimersTick)
+{
+  const uint32_t timeout = 5;
+  const uint32_t isrCalls = TICK_CMP / 4;
+  SFTM_TimerHandle_T testedTimer = SFTM_CreateTimer();
+  uint64_t remainingTime;
+
+  TEST_ASSERT_EQUAL_UINT64(UINT64_MAX, SFTM_GetTimerTimeUs(testedTimer));
+  SFTM_StartTimer(testedTimer, SFTM_ONE_SHOT, TimerOnExpireFunction, NULL, timeout);
+  SFTM_Advance(2);
+  remainingTime = SFTM_GetTimerRemainingUs(testedTimer);
+  for (uint32_t cnt = 0; cnt < isrCalls; cnt++)
+  {
+    SFTM_TimersHandler();
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(2, SFTM_GetTimerTick(testedTimer));
+  TEST_ASSERT_EQUAL_UINT64(remainingTime - isrCalls * 1000000ULL / SYSTEM_TICK_ISR_CLK, SFTM_GetTimerRemainingUs(testedTimer));
+  TEST_ASSERT_EQUAL_UINT64(timeout * 1000000ULL / TIMERS_CLK - SFTM_GetTimerRemainingUs(testedTimer), SFTM_GetTimerTimeUs(testedTimer));
+
+  for (uint32_t cnt = isrCalls; cnt < TICK_CMP; cnt++)
+  {
+    SFTM_TimersHandler();
+  }
+  TEST_ASSERT_EQUAL_UINT32(3, SFTM_GetTimerTick(testedTimer));
+  TEST_ASSERT_EQUAL_UINT64(remainingTime - 1000000ULL / TIMERS_CLK, SFTM_GetTimerRemainingUs(testedTimer));
+}
+#endif
+
+#if (SFTM_CFG_EVENT_QUEUE)
+TEST(SoftTimers, EventQueue_should_ReceiveExpiryEventsWithOverruns)
+{
+  uint32_t context = 0;
+  SFTM_Event_T events[3];
+  SFTM_Event_T event = { 0 };
+  SFTM_EventQueue_T queue;
+  SFTM_TimerHandle_T testedTimer = SFTM_CreateTimer();
+
+  SFTM_InitEventQueue(&queue, events, 3);
+  SFTM_SetTimerEventQueue(testedTimer, &queue);
+  SFTM_StartTimer(testedTimer, SFTM_AUTO_RELOAD, TimerOnExpireCountFunction, &context, 10);
+
+  SFTM_Advance(10 * 4);
+  TEST_ASSERT_EQUAL_UINT32(0, context);
+
+  TEST_ASSERT_TRUE(SFTM_GetEvent(&queue, &event));
+  TEST_ASSERT_EQUAL_PTR(&context, event.pContext);
+  TEST_ASSERT_EQUAL_UINT8(SFTM_GetTimerIndex(testedTimer), event.timerIdx);
+  TEST_ASSERT_EQUAL_UINT8(0, event.overruns);
+  TEST_ASSERT_TRUE(SFTM_GetEvent(&queue, &event));
+  TEST_ASSERT_FALSE(SFTM_GetEvent(&queue, &event));
+
+  SFTM_Advance(10);
+  TEST_ASSERT_TRUE(SFTM_GetEvent(&queue, &event));
+  TEST_ASSERT_EQUAL_UINT8(2, event.overruns);
+}
+#endif
+
+#if (SFTM_CFG_BATCH)
+TEST(SoftTimers, Batch_should_CallBatchCallbackOnceForAllExpiredContexts)
+{
+  uint32_t contexts[3] = { 0, 1, 2 };
+  SFTM_TimerHandle_T batchedTimers[3];
+  SFTM_TimerHandle_T otherTimer = SFTM_CreateTimer();
+
+  TEST_ASSERT_TRUE(SFTM_RegisterBatchCallback(TimerOnExpireCountFunction, TimerOnExpireBatchFunction));
+
+  for (uint32_t timerCnt = 0; timerCnt < 3; timerCnt++)
+  {
+    batchedTimers[timerCnt] = SFTM_CreateTimer();
+    SFTM_StartTimer(batchedTimers[timerCnt], SFTM_ONE_SHOT, TimerOnExpireCountFunction, &contexts[timerCnt], 5 + timerCnt / 2);
+  }
+  SFTM_StartTimer(otherTimer, SFTM_ONE_SHOT, TimerOnExpireFunction, NULL, 5);
+
+  SFTM_Advance(5);
+  TEST_ASSERT_EQUAL_UINT32(1, BatchCallsNumber);
+  TEST_ASSERT_EQUAL_UINT32(2, BatchContextsNumber);
+  TEST_ASSERT_EQUAL_UINT32(1, OnExpireCallsNumber);
+  TEST_ASSERT_EQUAL_UINT32(0, contexts[0]);
+  TEST_ASSERT_EQUAL(SFTM_TIMER_DONE, batchedTimers[1]->state);
+
+  SFTM_Advance(1);
+  TEST_ASSERT_EQUAL_UINT32(2, BatchCallsNumber);
+  TEST_ASSERT_EQUAL_UINT32(3, BatchContextsNumber);
+}
+#endif
+
+#if (SFTM_CFG_SNAPSHOT)
+TEST(SoftTimers, Snapshot_should_RestoreRemainingTimeAndCallbacks)
+{
+  uint32_t expirationsNumber = 0;
+  const SFTM_Callback_T callbacks[] = { { TimerOnExpireFunction, NULL }, { TimerOnExpireCountFunction, &expirationsNumber } };
+  uint8_t snapshot[SFTM_SNAPSHOT_SIZE(3)] = { 0 };
+  SFTM_TimerHandle_T reloadTimer = SFTM_CreateTimer();
+  SFTM_TimerHandle_T pausedTimer = SFTM_CreateTimer();
+  SFTM_TimerHandle_T idleTimer = SFTM_CreateTimer();
+
+  SFTM_StartTimer(reloadTimer, SFTM_AUTO_RELOAD, TimerOnExpireCountFunction, &expirationsNumber, 10);
+  SFTM_StartTimer(pausedTimer, SFTM_ONE_SHOT, TimerOnExpireFunction, NULL, 20);
+  SFTM_Advance(4);
+  SFTM_PauseTimer(pausedTimer);
+  TEST_ASSERT_EQUAL_UINT32(sizeof(snapshot), SFTM_SaveSnapshot(snapshot, sizeof(snapshot), callbacks, 2));
+
+  SFTM_Init();
+  CurrentTimersNumber = 0;
+  snapshot[1]++;
+  TEST_ASSERT_FALSE(SFTM_RestoreSnapshot(snapshot, sizeof(snapshot), callbacks, 2));
+  snapshot[1]--;
+  TEST_ASSERT_TRUE(SFTM_RestoreSnapshot(snapshot, sizeof(snapshot), callbacks, 2));
+  TEST_ASSERT_FALSE(SFTM_RestoreSnapshot(snapshot, sizeof(snapshot), callbacks, 2));
+
+  TEST_ASSERT_EQUAL(SFTM_TIMER_IDLE, idleTimer->state);
+  TEST_ASSERT_EQUAL_UINT32(4, SFTM_GetTimerTick(reloadTimer));
+  SFTM_Advance(6);
+  TEST_ASSERT_EQUAL_UINT32(1, expirationsNumber);
+  SFTM_ResumeTimer(pausedTimer);
+  SFTM_Advance(15);
+  TEST_ASSERT_EQUAL_UINT32(0, OnExpireCallsNumber);
+  SFTM_Advance(1);
+  TEST_ASSERT_EQUAL_UINT32(1, OnExpireCallsNumber);
+}
+
+TEST(SoftTimers, Snapshot_should_NotSaveTimerWithCallbackMissingFromTable)
+{
+  uint32_t expirationsNumber = 0;
+  const SFTM_Callback_T callbacks[] = { { TimerOnExpireFunction, NULL } };
+  uint8_t snapshot[SFTM_SNAPSHOT_SIZE(2)] = { 0 };
+  SFTM_TimerHandle_T knownTimer = SFTM_CreateTimer();
+  SFTM_TimerHandle_T unknownTimer = SFTM_CreateTimer();
+
+  SFTM_StartTimer(knownTimer, SFTM_ONE_SHOT, TimerOnExpireFunction, NULL, 10);
+  SFTM_StartTimer(unknownTimer, SFTM_ONE_SHOT, TimerOnExpireCountFunction, &expirationsNumber, 10);
+  TEST_ASSERT_EQUAL_UINT32(0, SFTM_SaveSnapshot(snapshot, sizeof(snapshot), callbacks, 1));
+
+  SFTM_StopTimer(unknownTimer);
+  TEST_ASSERT_EQUAL_UINT32(sizeof(snapshot), SFTM_SaveSnapshot(snapshot, sizeof(snapshot), callbacks, 1));
 }
+#endif
 
 /**
  * @}
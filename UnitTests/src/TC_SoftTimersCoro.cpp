@@ -0,0 +1,199 @@
+/*=======================================================================================*
+ * @file    TC_SoftTimersCoro.cpp
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains unit tests for Soft Timers C++20 coroutine awaitables.
+ *======================================================================================*/
+
+/**
+ * @addtogroup Soft Timers Coroutines Unit Tests Description
+ * @{
+ * @brief Tests of sftm::sleep_for and sftm::timeout awaitables.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+#include <chrono>
+#include <coroutine>
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "SoftTimersCoro.hpp"
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+/*======================================================================================*/
+/*                      ####### LOCAL TYPE DECLARATIONS #######                         */
+/*======================================================================================*/
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+/** @struct Task
+ *          Coroutine which starts eagerly and destroys its frame on completion, its handle
+ *          can be used only while it is suspended.
+ */
+struct Task
+{
+  struct promise_type;
+
+  std::coroutine_handle<promise_type> coroutine;   ///< Handle of coroutine frame
+
+  struct promise_type
+  {
+    Task get_return_object() { return { std::coroutine_handle<promise_type>::from_promise(*this) }; }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() {}
+    void unhandled_exception() {}
+  };
+};
+
+/*======================================================================================*/
+/*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
+/*======================================================================================*/
+static Task SleepTask(std::chrono::milliseconds duration);
+static Task TimeoutTask(sftm::Event &event, std::chrono::milliseconds duration);
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*---------------------------------- LOCAL OBJECTS -------------------------------------*/
+TEST_GROUP(SoftTimersCoro);
+static uint32_t ResumesNumber = 0;
+static uint32_t EventsNumber = 0;
+
+using namespace std::chrono_literals;
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+static Task SleepTask(std::chrono::milliseconds duration)
+{
+  co_await sftm::sleep_for(duration);
+  ResumesNumber++;
+}
+
+static Task TimeoutTask(sftm::Event &event, std::chrono::milliseconds duration)
+{
+  bool eventSet = co_await sftm::timeout(event, duration);
+
+  ResumesNumber++;
+  if (eventSet)
+  {
+    EventsNumber++;
+  }
+  else { /* Do nothing */ }
+}
+
+/*======================================================================================*/
+/*                        ####### TESTS DEFINITIONS #######                             */
+/*======================================================================================*/
+TEST_SETUP(SoftTimersCoro)
+{
+  ResumesNumber = 0;
+  EventsNumber = 0;
+}
+
+TEST_TEAR_DOWN(SoftTimersCoro)
+{
+
+}
+
+TEST(SoftTimersCoro, SleepFor_should_ResumeCoroutineAfterDuration)
+{
+  SleepTask(5ms);
+
+  SFTM_Advance(sftm::ToTicks(4ms));
+  TEST_ASSERT_EQUAL_UINT32(0, ResumesNumber);
+
+  SFTM_Advance(sftm::ToTicks(1ms));
+  TEST_ASSERT_EQUAL_UINT32(1, ResumesNumber);
+}
+
+TEST(SoftTimersCoro, SleepFor_should_SuspendAsManyCoroutinesAsConfigured)
+{
+  for (uint32_t awaitCnt = 0; awaitCnt < SFTM_CORO_MAX_AWAITS; awaitCnt++)
+  {
+    SleepTask(std::chrono::milliseconds(awaitCnt + 1));
+  }
+
+  SFTM_Advance(sftm::ToTicks(std::chrono::milliseconds(SFTM_CORO_MAX_AWAITS)));
+  TEST_ASSERT_EQUAL_UINT32(SFTM_CORO_MAX_AWAITS, ResumesNumber);
+}
+
+TEST(SoftTimersCoro, Timeout_should_ResumeWithFalseWhenEventIsNotSet)
+{
+  sftm::Event event;
+
+  TimeoutTask(event, 10ms);
+
+  SFTM_Advance(sftm::ToTicks(9ms));
+  TEST_ASSERT_EQUAL_UINT32(0, ResumesNumber);
+
+  SFTM_Advance(sftm::ToTicks(1ms));
+  TEST_ASSERT_EQUAL_UINT32(1, ResumesNumber);
+  TEST_ASSERT_EQUAL_UINT32(0, EventsNumber);
+
+  /* Event set after timeout has no waiter */
+  event.Set();
+  TEST_ASSERT_EQUAL_UINT32(1, ResumesNumber);
+}
+
+TEST(SoftTimersCoro, Timeout_should_ResumeWithTrueAndCancelTimeoutWhenEventIsSet)
+{
+  sftm::Event event;
+
+  TimeoutTask(event, 10ms);
+
+  SFTM_Advance(sftm::ToTicks(3ms));
+  event.Set();
+  TEST_ASSERT_EQUAL_UINT32(1, ResumesNumber);
+  TEST_ASSERT_EQUAL_UINT32(1, EventsNumber);
+
+  SFTM_Advance(sftm::ToTicks(20ms));
+  TEST_ASSERT_EQUAL_UINT32(1, ResumesNumber);
+  TEST_ASSERT_EQUAL_UINT32(SFTM_NO_EXPIRY, SFTM_GetTicksUntilNextExpiry());
+}
+
+TEST(SoftTimersCoro, Timeout_should_NotSuspendWhenEventIsAlreadySet)
+{
+  sftm::Event event;
+
+  event.Set();
+  TimeoutTask(event, 10ms);
+
+  TEST_ASSERT_EQUAL_UINT32(1, ResumesNumber);
+  TEST_ASSERT_EQUAL_UINT32(1, EventsNumber);
+}
+
+TEST(SoftTimersCoro, SleepFor_should_StopTimerWhenSuspendedCoroutineIsDestroyed)
+{
+  Task task = SleepTask(5ms);
+
+  task.coroutine.destroy();
+  TEST_ASSERT_EQUAL_UINT32(SFTM_NO_EXPIRY, SFTM_GetTicksUntilNextExpiry());
+
+  SFTM_Advance(sftm::ToTicks(10ms));
+  TEST_ASSERT_EQUAL_UINT32(0, ResumesNumber);
+}
+
+TEST(SoftTimersCoro, Timeout_should_StopTimerAndLeaveEventWhenSuspendedCoroutineIsDestroyed)
+{
+  sftm::Event event;
+  Task task = TimeoutTask(event, 10ms);
+
+  task.coroutine.destroy();
+  TEST_ASSERT_EQUAL_UINT32(SFTM_NO_EXPIRY, SFTM_GetTicksUntilNextExpiry());
+
+  event.Set();
+  SFTM_Advance(sftm::ToTicks(20ms));
+  TEST_ASSERT_EQUAL_UINT32(0, ResumesNumber);
+}
+
+/**
+ * @}
+ */
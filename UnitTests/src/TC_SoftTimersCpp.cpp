@@ -0,0 +1,206 @@
+/*=======================================================================================*
+ * @file    TC_SoftTimersCpp.cpp
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains unit tests for Soft Timers C++ wrapper.
+ *======================================================================================*/
+
+/**
+ * @addtogroup Soft Timers C++ Unit Tests Description
+ * @{
+ * @brief Tests of sftm::Timer callbacks and timer slot ownership.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+#include <chrono>
+#include <utility>
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "SoftTimers.hpp"
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+/*======================================================================================*/
+/*                      ####### LOCAL TYPE DECLARATIONS #######                         */
+/*======================================================================================*/
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+/** @struct Counter
+ *          Object passed to timer callbacks.
+ */
+struct Counter
+{
+  uint32_t callsNumber = 0;             ///< Number of callback calls
+
+  void Increment()
+  {
+    callsNumber++;
+  }
+};
+
+/*======================================================================================*/
+/*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
+/*======================================================================================*/
+static void TimerOnExpireFunction(void);
+static void TimerOnExpireCounterFunction(Counter &counter);
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*---------------------------------- LOCAL OBJECTS -------------------------------------*/
+TEST_GROUP(SoftTimersCpp);
+static uint32_t OnExpireCallsNumber = 0;
+
+using namespace std::chrono_literals;
+using FunctionTimer = sftm::Timer<TimerOnExpireFunction>;
+
+static_assert(sizeof(FunctionTimer) == sizeof(SFTM_TimerHandle_T), "Timer has to hold timer handle only");
+static_assert(sftm::ToTicks(1500us) == sftm::ToTicks(2ms), "Timeout has to be rounded up to ticks");
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+static void TimerOnExpireFunction(void)
+{
+  OnExpireCallsNumber++;
+}
+
+static void TimerOnExpireCounterFunction(Counter &counter)
+{
+  counter.callsNumber++;
+}
+
+/*======================================================================================*/
+/*                        ####### TESTS DEFINITIONS #######                             */
+/*======================================================================================*/
+TEST_SETUP(SoftTimersCpp)
+{
+  OnExpireCallsNumber = 0;
+}
+
+TEST_TEAR_DOWN(SoftTimersCpp)
+{
+
+}
+
+TEST(SoftTimersCpp, Timer_should_CallFreeFunction)
+{
+  FunctionTimer timer;
+
+  TEST_ASSERT_EQUAL(SFTM_TIMER_STARTED, timer.Start(SFTM_ONE_SHOT, 5ms));
+  SFTM_Advance(sftm::ToTicks(4ms));
+  TEST_ASSERT_EQUAL_UINT32(0, OnExpireCallsNumber);
+
+  SFTM_Advance(sftm::ToTicks(1ms));
+  TEST_ASSERT_EQUAL_UINT32(1, OnExpireCallsNumber);
+  TEST_ASSERT_EQUAL(SFTM_EXPIRED, timer.GetStatus());
+}
+
+TEST(SoftTimersCpp, Timer_should_CallFunctionWithObjectReference)
+{
+  sftm::Timer<TimerOnExpireCounterFunction> timer;
+  Counter counter;
+
+  timer.Start(SFTM_AUTO_RELOAD, 2ms, counter);
+  SFTM_Advance(sftm::ToTicks(6ms));
+
+  TEST_ASSERT_EQUAL_UINT32(3, counter.callsNumber);
+}
+
+TEST(SoftTimersCpp, Timer_should_CallMemberFunctionOfObject)
+{
+  sftm::Timer<&Counter::Increment> timer;
+  Counter counter;
+
+  timer.Start(SFTM_AUTO_RELOAD, 2ms, counter);
+  SFTM_Advance(sftm::ToTicks(6ms));
+  timer.Stop();
+  SFTM_Advance(sftm::ToTicks(6ms));
+
+  TEST_ASSERT_EQUAL_UINT32(3, counter.callsNumber);
+}
+
+TEST(SoftTimersCpp, Timer_should_KeepRunningTimerWhenMoveConstructed)
+{
+  FunctionTimer movedTimer;
+  SFTM_TimerHandle_T timerHandle = movedTimer.GetHandle();
+
+  movedTimer.Start(SFTM_ONE_SHOT, 5ms);
+  FunctionTimer timer(std::move(movedTimer));
+
+  TEST_ASSERT_NULL(movedTimer.GetHandle());
+  TEST_ASSERT_EQUAL_PTR(timerHandle, timer.GetHandle());
+
+  SFTM_Advance(sftm::ToTicks(5ms));
+  TEST_ASSERT_EQUAL_UINT32(1, OnExpireCallsNumber);
+}
+
+TEST(SoftTimersCpp, Timer_should_ReleaseOwnSlotWhenMoveAssigned)
+{
+  FunctionTimer movedTimer;
+  FunctionTimer timer;
+  SFTM_TimerHandle_T movedTimerHandle = movedTimer.GetHandle();
+  SFTM_TimerHandle_T releasedTimerHandle = timer.GetHandle();
+
+  movedTimer.Start(SFTM_ONE_SHOT, 5ms);
+  timer.Start(SFTM_ONE_SHOT, 2ms);
+  timer = std::move(movedTimer);
+
+  TEST_ASSERT_NULL(movedTimer.GetHandle());
+  TEST_ASSERT_EQUAL_PTR(movedTimerHandle, timer.GetHandle());
+  TEST_ASSERT_EQUAL(SFTM_TIMER_FREE, releasedTimerHandle->state);
+
+  SFTM_Advance(sftm::ToTicks(5ms));
+  TEST_ASSERT_EQUAL_UINT32(1, OnExpireCallsNumber);
+}
+
+TEST(SoftTimersCpp, TimerSlot_should_ReleaseSlotInDestructor)
+{
+  SFTM_TimerHandle_T timerHandle;
+
+  {
+    FunctionTimer timer;
+
+    timerHandle = timer.GetHandle();
+    timer.Start(SFTM_ONE_SHOT, 5ms);
+  }
+
+  TEST_ASSERT_EQUAL(SFTM_TIMER_FREE, timerHandle->state);
+  SFTM_Advance(sftm::ToTicks(5ms));
+  TEST_ASSERT_EQUAL_UINT32(0, OnExpireCallsNumber);
+
+  /* Released slot is handed out again once all slots were created */
+  sftm::TimerSlot slots[MAX_TIMER_SLOTS];
+  bool slotReused = false;
+
+  for (const sftm::TimerSlot &slot : slots)
+  {
+    slotReused = slotReused || (timerHandle == slot.GetHandle());
+  }
+  TEST_ASSERT_TRUE(slotReused);
+}
+
+#if (SFTM_CFG_INLINE_CONTEXT)
+TEST(SoftTimersCpp, InlineTimer_should_CallLambdaWithCapturedState)
+{
+  sftm::InlineTimer timer;
+  Counter counter;
+  Counter *pCounter = &counter;
+
+  timer.Start(SFTM_AUTO_RELOAD, 2ms, [pCounter]() { pCounter->Increment(); });
+  SFTM_Advance(sftm::ToTicks(4ms));
+
+  TEST_ASSERT_EQUAL_UINT32(2, counter.callsNumber);
+}
+#endif
+
+/**
+ * @}
+ */
@@ -0,0 +1,226 @@
+/*=======================================================================================*
+ * @file    TC_SoftTimersHiRes.c
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains unit tests for Soft Timers high resolution timers.
+ *======================================================================================*/
+
+/**
+ * @addtogroup Soft Timers High Resolution Unit Tests Description
+ * @{
+ * @brief Tests of microsecond resolution timers.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "SoftTimersHiRes.c"
+
+#if (SFTM_CFG_HIRES)
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+#define ISR_PERIOD_US                 (1000000UL / SYSTEM_TICK_ISR_CLK)       ///< System tick ISR period in us
+#define TIMERS_TICK_US                (1000000UL / TIMERS_CLK)                ///< Timers tick period in us
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*---------------------------------- LOCAL OBJECTS -------------------------------------*/
+TEST_GROUP(SoftTimersHiRes);
+
+static uint32_t OnExpireCallsNumber;
+static uint32_t PeriodMissesNumber;
+
+/*======================================================================================*/
+/*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
+/*======================================================================================*/
+static void RunTimersFor(uint32_t timeUs);
+static void TimerOnExpireFunction(void *pContext);
+static void TimerOnExpirePeriodFunction(void *pContext);
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+static void RunTimersFor(uint32_t timeUs)
+{
+  for (uint32_t isrCnt = 0; isrCnt < timeUs / ISR_PERIOD_US; isrCnt++)
+  {
+    SFTM_TimersHandler();
+    SFTM_TimersEventsHandler();
+  }
+}
+
+static void TimerOnExpireFunction(void *pContext)
+{
+  OnExpireCallsNumber++;
+}
+
+static void TimerOnExpirePeriodFunction(void *pContext)
+{
+  OnExpireCallsNumber++;
+
+  if (SFTM_GetTimeUS() != OnExpireCallsNumber * *(SFTM_timeoutUS*)pContext)
+  {
+    PeriodMissesNumber++;
+  }
+}
+
+/*======================================================================================*/
+/*                        ####### TESTS DEFINITIONS #######                             */
+/*======================================================================================*/
+TEST_SETUP(SoftTimersHiRes)
+{
+  SFTM_Init();
+  CurrentHiResTimersNumber = 0;
+  OnExpireCallsNumber = 0;
+  PeriodMissesNumber = 0;
+}
+
+TEST_TEAR_DOWN(SoftTimersHiRes)
+{
+
+}
+
+TEST(SoftTimersHiRes, TimeBase_should_CountMicroseconds)
+{
+  TEST_ASSERT_EQUAL_UINT64(0, SFTM_GetTimeUS());
+
+  RunTimersFor(1500);
+
+  TEST_ASSERT_EQUAL_UINT64(1500, SFTM_GetTimeUS());
+}
+
+TEST(SoftTimersHiRes, Timer_should_CallOnExpireOnlyOneTimeWhenItIsSingleShotType)
+{
+  SFTM_HiResTimerHandle_T timer = SFTM_CreateHiResTimer();
+
+  SFTM_StartHiResTimer(timer, SFTM_ONE_SHOT, TimerOnExpireFunction, NULL, 250);
+
+  RunTimersFor(249);
+  TEST_ASSERT_EQUAL_UINT32(0, OnExpireCallsNumber);
+  TEST_ASSERT_EQUAL(SFTM_NOT_EXPIRED, SFTM_GetHiResTimerStatus(timer));
+
+  RunTimersFor(1000);
+  TEST_ASSERT_EQUAL_UINT32(1, OnExpireCallsNumber);
+  TEST_ASSERT_EQUAL(SFTM_EXPIRED, SFTM_GetHiResTimerStatus(timer));
+  TEST_ASSERT_EQUAL(SFTM_TIMER_IN_USE, SFTM_StartHiResTimer(timer, SFTM_ONE_SHOT, TimerOnExpireFunction, NULL, 250));
+}
+
+TEST(SoftTimersHiRes, Timer_should_ReloadFromDeadlineWithoutDrift)
+{
+  SFTM_HiResTimerHandle_T timer = SFTM_CreateHiResTimer();
+  SFTM_timeoutUS period = 125;
+
+  SFTM_StartHiResTimer(timer, SFTM_AUTO_RELOAD, TimerOnExpirePeriodFunction, &period, period);
+
+  RunTimersFor(10000);
+
+  TEST_ASSERT_EQUAL_UINT32(80, OnExpireCallsNumber);
+  TEST_ASSERT_EQUAL_UINT32(0, PeriodMissesNumber);
+}
+
+TEST(SoftTimersHiRes, Timer_should_NotCallOnExpireWhenStoppedBeforeDispatch)
+{
+  SFTM_HiResTimerHandle_T timer = SFTM_CreateHiResTimer();
+
+  SFTM_StartHiResTimer(timer, SFTM_AUTO_RELOAD, TimerOnExpireFunction, NULL, 100);
+
+  for (uint32_t isrCnt = 0; isrCnt < 100 / ISR_PERIOD_US; isrCnt++)
+  {
+    SFTM_TimersHandler();
+  }
+  SFTM_StopHiResTimer(timer);
+  SFTM_TimersEventsHandler();
+
+  TEST_ASSERT_EQUAL_UINT32(0, OnExpireCallsNumber);
+  TEST_ASSERT_EQUAL(SFTM_EXPIRED, SFTM_GetHiResTimerStatus(timer));
+}
+
+TEST(SoftTimersHiRes, Timer_should_NotDispatchOldExpiryWhenStartedAgainBeforeDispatch)
+{
+  SFTM_HiResTimerHandle_T timer = SFTM_CreateHiResTimer();
+
+  SFTM_StartHiResTimer(timer, SFTM_ONE_SHOT, TimerOnExpireFunction, NULL, 100);
+
+  for (uint32_t isrCnt = 0; isrCnt < 100 / ISR_PERIOD_US; isrCnt++)
+  {
+    SFTM_TimersHandler();
+  }
+  SFTM_StopHiResTimer(timer);
+  SFTM_StartHiResTimer(timer, SFTM_ONE_SHOT, TimerOnExpireFunction, NULL, 500);
+  SFTM_TimersEventsHandler();
+
+  TEST_ASSERT_EQUAL_UINT32(0, OnExpireCallsNumber);
+  TEST_ASSERT_EQUAL(SFTM_NOT_EXPIRED, SFTM_GetHiResTimerStatus(timer));
+
+  RunTimersFor(499);
+  TEST_ASSERT_EQUAL_UINT32(0, OnExpireCallsNumber);
+  RunTimersFor(1);
+  TEST_ASSERT_EQUAL_UINT32(1, OnExpireCallsNumber);
+}
+
+TEST(SoftTimersHiRes, Timer_should_ExpireWhenTimeIsAdvanced)
+{
+  SFTM_HiResTimerHandle_T timer = SFTM_CreateHiResTimer();
+
+  SFTM_StartHiResTimer(timer, SFTM_ONE_SHOT, TimerOnExpireFunction, NULL, 2 * TIMERS_TICK_US + 500);
+
+  SFTM_Advance(2);
+  TEST_ASSERT_EQUAL_UINT32(0, OnExpireCallsNumber);
+  TEST_ASSERT_EQUAL_UINT64(2 * TIMERS_TICK_US, SFTM_GetTimeUS());
+
+  SFTM_Advance(1);
+  TEST_ASSERT_EQUAL_UINT32(1, OnExpireCallsNumber);
+  TEST_ASSERT_EQUAL_UINT64(3 * TIMERS_TICK_US, SFTM_GetTimeUS());
+}
+
+TEST(SoftTimersHiRes, IdleSleep_should_SleepWholeTickForDeadlineWithinTick)
+{
+  SFTM_HiResTimerHandle_T timer = SFTM_CreateHiResTimer();
+
+  SFTM_StartHiResTimer(timer, SFTM_ONE_SHOT, TimerOnExpireFunction, NULL, 250);
+
+  TEST_ASSERT_EQUAL_UINT32(1, SFTM_GetTicksUntilNextExpiry());
+  TEST_ASSERT_EQUAL_UINT32(1, SFTM_IdleSleep());
+  TEST_ASSERT_EQUAL_UINT32(0, SFTM_GetTicksUntilNextExpiry());
+
+  SFTM_TimersEventsHandler();
+  TEST_ASSERT_EQUAL_UINT32(1, OnExpireCallsNumber);
+  TEST_ASSERT_EQUAL_UINT64(TIMERS_TICK_US, SFTM_GetTimeUS());
+}
+
+TEST(SoftTimersHiRes, Timer_should_ExpireOnPortCompare)
+{
+  SFTM_HiResTimerHandle_T timer = SFTM_CreateHiResTimer();
+
+  SFTM_PortStartTick();
+  SFTM_StartHiResTimer(timer, SFTM_ONE_SHOT, TimerOnExpireFunction, NULL, 300);
+  while (0 == OnExpireCallsNumber)
+  {
+    SFTM_PortWaitEvents();
+    SFTM_TimersEventsHandler();
+  }
+  SFTM_PortStopTick();
+  while (SFTM_GetTimeNs() % (TIMERS_TICK_US * NS_PER_US) != 0)
+  {
+    /* Leave time on timers tick boundary for following tests */
+    SFTM_TimersHandler();
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(1, OnExpireCallsNumber);
+  TEST_ASSERT_TRUE(SFTM_GetTimeUS() >= 300);
+}
+
+#endif /* SFTM_CFG_HIRES */
+
+/**
+ * @}
+ */
@@ -0,0 +1,93 @@
+/*=======================================================================================*
+ * @file    TC_SoftTimersStats.c
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains unit tests for Soft Timers statistics.
+ *======================================================================================*/
+
+/**
+ * @addtogroup Soft Timers Statistics Unit Tests Description
+ * @{
+ * @brief Tests of histograms used by Soft Timers instrumentation.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "SoftTimersStats.c"
+
+#if (SFTM_CFG_INSTRUMENTATION)
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*---------------------------------- LOCAL OBJECTS -------------------------------------*/
+TEST_GROUP(SoftTimersStats);
+
+/*======================================================================================*/
+/*                        ####### TESTS DEFINITIONS #######                             */
+/*======================================================================================*/
+TEST_SETUP(SoftTimersStats)
+{
+  SFTM_StatsReset();
+}
+
+TEST_TEAR_DOWN(SoftTimersStats)
+{
+
+}
+
+TEST(SoftTimersStats, RecordTick_should_PutSamplesIntoLog2Buckets)
+{
+  const SFTM_Histogram_T *pHistogram = SFTM_StatsGetTickHistogram();
+
+  SFTM_StatsRecordTick(0);
+  SFTM_StatsRecordTick(1);
+  SFTM_StatsRecordTick(2);
+  SFTM_StatsRecordTick(3);
+  SFTM_StatsRecordTick(1000);
+  SFTM_StatsRecordTick(0xFFFFFFFF);
+
+  TEST_ASSERT_EQUAL_UINT32(1, pHistogram->buckets[0]);
+  TEST_ASSERT_EQUAL_UINT32(1, pHistogram->buckets[1]);
+  TEST_ASSERT_EQUAL_UINT32(2, pHistogram->buckets[2]);
+  TEST_ASSERT_EQUAL_UINT32(1, pHistogram->buckets[10]);
+  TEST_ASSERT_EQUAL_UINT32(1, pHistogram->buckets[SFTM_STATS_HISTOGRAM_BUCKETS - 1]);
+  TEST_ASSERT_EQUAL_UINT32(6, pHistogram->samples);
+  TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFF, pHistogram->maxValue);
+}
+
+TEST(SoftTimersStats, GetPercentile_should_ReturnUpperBoundOfBucket)
+{
+  const SFTM_Histogram_T *pHistogram = SFTM_StatsGetTickHistogram();
+
+  for (uint32_t cnt = 0; cnt < 90; cnt++)
+  {
+    SFTM_StatsRecordTick(5);
+  }
+  for (uint32_t cnt = 0; cnt < 10; cnt++)
+  {
+    SFTM_StatsRecordTick(100);
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(7, SFTM_StatsGetPercentile(pHistogram, 50));
+  TEST_ASSERT_EQUAL_UINT32(7, SFTM_StatsGetPercentile(pHistogram, 90));
+  TEST_ASSERT_EQUAL_UINT32(100, SFTM_StatsGetPercentile(pHistogram, 99));
+  TEST_ASSERT_EQUAL_UINT32(14, SFTM_StatsGetMean(pHistogram));
+}
+
+#endif /* SFTM_CFG_INSTRUMENTATION */
+
+/**
+ * @}
+ */
@@ -0,0 +1,82 @@
+/*=======================================================================================*
+ * @file    TC_SoftTimersTrace.c
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains unit tests for Soft Timers trace.
+ *======================================================================================*/
+
+/**
+ * @addtogroup Soft Timers Trace Unit Tests Description
+ * @{
+ * @brief Tests of Soft Timers trace ring buffer.
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "SoftTimersTrace.c"
+
+#if (SFTM_CFG_TRACE)
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*---------------------------------- LOCAL OBJECTS -------------------------------------*/
+TEST_GROUP(SoftTimersTrace);
+
+/*======================================================================================*/
+/*                        ####### TESTS DEFINITIONS #######                             */
+/*======================================================================================*/
+TEST_SETUP(SoftTimersTrace)
+{
+  SFTM_TraceInit();
+}
+
+TEST_TEAR_DOWN(SoftTimersTrace)
+{
+
+}
+
+TEST(SoftTimersTrace, TraceInit_should_FillBufferHeader)
+{
+  const SFTM_TraceBuffer_T *pTrace = SFTM_TraceGetBuffer();
+
+  TEST_ASSERT_EQUAL_UINT32(SFTM_TRACE_MAGIC, pTrace->magic);
+  TEST_ASSERT_EQUAL_UINT16(SFTM_TRACE_VERSION, pTrace->version);
+  TEST_ASSERT_EQUAL_UINT16(SFTM_TRACE_BUFFER_SIZE, pTrace->recordsNumber);
+  TEST_ASSERT_EQUAL_UINT32(0, pTrace->head);
+  TEST_ASSERT_EQUAL_UINT32(8, sizeof(SFTM_TraceRecord_T));
+}
+
+TEST(SoftTimersTrace, TraceRecord_should_OverwriteOldestRecordsWhenBufferIsFull)
+{
+  const SFTM_TraceBuffer_T *pTrace = SFTM_TraceGetBuffer();
+
+  for (uint32_t cnt = 0; cnt < SFTM_TRACE_BUFFER_SIZE + 3; cnt++)
+  {
+    SFTM_TraceRecord(SFTM_TRACE_EXPIRE, 1, cnt, 7);
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(SFTM_TRACE_BUFFER_SIZE + 3, pTrace->head);
+  TEST_ASSERT_EQUAL_UINT32(SFTM_TRACE_BUFFER_SIZE + 2, pTrace->records[2].tick);
+  TEST_ASSERT_EQUAL_UINT32(3, pTrace->records[3].tick);
+  TEST_ASSERT_EQUAL_UINT16(7, pTrace->records[3].subTick);
+  TEST_ASSERT_EQUAL_UINT8(SFTM_TRACE_EXPIRE, pTrace->records[3].event);
+  TEST_ASSERT_EQUAL_UINT8(1, pTrace->records[3].timerIdx);
+}
+
+#endif /* SFTM_CFG_TRACE */
+
+/**
+ * @}
+ */
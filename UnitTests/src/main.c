@@ -12,6 +12,7 @@
 
 /*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
 #include "unity_fixture.h"
+#include "SoftTimersConfig.h"
 
 /*======================================================================================*/
 /*                           ####### TESTS GROUPS #######                               */
@@ -23,8 +24,94 @@ TEST_GROUP_RUNNER(SoftTimers)
   RUN_TEST_CASE(SoftTimers, Timer_should_CallOnExpireWhenTimerReachesTimeoutOnFirstTimerSlot);
   RUN_TEST_CASE(SoftTimers, Timer_should_CallOnExpireWhenTimerReachesTimeoutOnLastTimerSlot);
   RUN_TEST_CASE(SoftTimers, Timer_should_CallOnExpireEveryExpirationWhenItIsAutoreloaded);
+  RUN_TEST_CASE(SoftTimers, Timer_should_OperateIndependently);
+  RUN_TEST_CASE(SoftTimers, Advance_should_CallOnExpireEveryExpirationWhenItIsAutoreloaded);
+  RUN_TEST_CASE(SoftTimers, Advance_should_DispatchTimersInDeadlineOrder);
+  RUN_TEST_CASE(SoftTimers, Advance_should_ExpireEveryTimerExactlyOnItsDeadline);
+  RUN_TEST_CASE(SoftTimers, Advance_should_NotDispatchStoppedTimer);
+  RUN_TEST_CASE(SoftTimers, CreateTimer_should_InitializeSlotItHandsOut);
+  RUN_TEST_CASE(SoftTimers, DeleteTimer_should_ReleaseSlotForNextCreatedTimer);
+  RUN_TEST_CASE(SoftTimers, Dispatch_should_KeepChangesMadeByCallbackToItsOwnTimer);
+#if !(SFTM_CFG_COMPACT)
+  RUN_TEST_CASE(SoftTimers, Advance_should_ExpireFarFutureTimerExactlyOnItsDeadline);
+#endif
+  RUN_TEST_CASE(SoftTimers, PauseTimer_should_FreezeRemainingTimeOutsideOfRunningTimers);
+  RUN_TEST_CASE(SoftTimers, PauseTimer_should_KeepAutoReloadTimerPausedFromItsCallback);
+  RUN_TEST_CASE(SoftTimers, GetTicksUntilNextExpiry_should_ReturnTicksToEarliestDeadline);
+  RUN_TEST_CASE(SoftTimers, IdleSleep_should_SleepUntilEarliestDeadline);
+  RUN_TEST_CASE(SoftTimers, PortTick_should_ExpireTimerWhileOtherThreadRestartsTimers);
+#if (SFTM_CFG_GROUPS)
+  RUN_TEST_CASE(SoftTimers, Group_should_StopAllMembersWithSingleCall);
+  RUN_TEST_CASE(SoftTimers, Group_should_PauseAndResumeMembersKeepingRemainingTime);
+  RUN_TEST_CASE(SoftTimers, Group_should_PostponeMembersWhenShifted);
+#endif
+#if (SFTM_CFG_STATIC_TIMERS)
+  RUN_TEST_CASE(SoftTimers, StaticTimer_should_BeConfiguredWithoutCreateCall);
+#endif
+#if (SFTM_CFG_COMPACT)
+  RUN_TEST_CASE(SoftTimers, Compact_should_ExpireOnDeadlineAcrossLowHalfWraparound);
+  RUN_TEST_CASE(SoftTimers, Compact_should_ReuseCallbacksTableEntriesOfStoppedTimers);
+#endif
+#if (SFTM_CFG_INLINE_CONTEXT)
+  RUN_TEST_CASE(SoftTimers, InlineContext_should_PassCopyStoredInTimerToCallback);
+#endif
+#if (SFTM_CFG_COMMAND_QUEUE)
+  RUN_TEST_CASE(SoftTimers, CommandQueue_should_ApplyPostedCommandsInOrderAtNextHandlerCall);
+#endif
+#if (SFTM_CFG_SUBTICK)
+  RUN_TEST_CASE(SoftTimers, SubTick_should_CountSystemTickIsrCallsWithinTimersTick);
+#endif
+#if (SFTM_CFG_EVENT_QUEUE)
+  RUN_TEST_CASE(SoftTimers, EventQueue_should_ReceiveExpiryEventsWithOverruns);
+#endif
+#if (SFTM_CFG_BATCH)
+  RUN_TEST_CASE(SoftTimers, Batch_should_CallBatchCallbackOnceForAllExpiredContexts);
+#endif
+#if (SFTM_CFG_SNAPSHOT)
+  RUN_TEST_CASE(SoftTimers, Snapshot_should_RestoreRemainingTimeAndCallbacks);
+  RUN_TEST_CASE(SoftTimers, Snapshot_should_NotSaveTimerWithCallbackMissingFromTable);
+#endif
+#if (SFTM_CFG_INSTRUMENTATION)
+  RUN_TEST_CASE(SoftTimers, Timer_should_RecordCallbackAndHandlerExecutionTime);
+#endif
+#if (SFTM_CFG_LATENESS)
+  RUN_TEST_CASE(SoftTimers, Timer_should_RecordLatenessBetweenExpiryAndDispatch);
+#endif
+#if (SFTM_CFG_TRACE)
+  RUN_TEST_CASE(SoftTimers, Timer_should_TraceLifecycleEvents);
+#endif
 }
 
+#if (SFTM_CFG_INSTRUMENTATION)
+TEST_GROUP_RUNNER(SoftTimersStats)
+{
+  RUN_TEST_CASE(SoftTimersStats, RecordTick_should_PutSamplesIntoLog2Buckets);
+  RUN_TEST_CASE(SoftTimersStats, GetPercentile_should_ReturnUpperBoundOfBucket);
+}
+#endif
+
+#if (SFTM_CFG_HIRES)
+TEST_GROUP_RUNNER(SoftTimersHiRes)
+{
+  RUN_TEST_CASE(SoftTimersHiRes, TimeBase_should_CountMicroseconds);
+  RUN_TEST_CASE(SoftTimersHiRes, Timer_should_CallOnExpireOnlyOneTimeWhenItIsSingleShotType);
+  RUN_TEST_CASE(SoftTimersHiRes, Timer_should_ReloadFromDeadlineWithoutDrift);
+  RUN_TEST_CASE(SoftTimersHiRes, Timer_should_NotCallOnExpireWhenStoppedBeforeDispatch);
+  RUN_TEST_CASE(SoftTimersHiRes, Timer_should_NotDispatchOldExpiryWhenStartedAgainBeforeDispatch);
+  RUN_TEST_CASE(SoftTimersHiRes, Timer_should_ExpireWhenTimeIsAdvanced);
+  RUN_TEST_CASE(SoftTimersHiRes, IdleSleep_should_SleepWholeTickForDeadlineWithinTick);
+  RUN_TEST_CASE(SoftTimersHiRes, Timer_should_ExpireOnPortCompare);
+}
+#endif
+
+#if (SFTM_CFG_TRACE)
+TEST_GROUP_RUNNER(SoftTimersTrace)
+{
+  RUN_TEST_CASE(SoftTimersTrace, TraceInit_should_FillBufferHeader);
+  RUN_TEST_CASE(SoftTimersTrace, TraceRecord_should_OverwriteOldestRecordsWhenBufferIsFull);
+}
+#endif
+
 /*======================================================================================*/
 /*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
 /*======================================================================================*/
@@ -36,6 +123,15 @@ static void RunAllTests(void);
 static void RunAllTests(void)
 {
   RUN_TEST_GROUP(SoftTimers);
+#if (SFTM_CFG_INSTRUMENTATION)
+  RUN_TEST_GROUP(SoftTimersStats);
+#endif
+#if (SFTM_CFG_HIRES)
+  RUN_TEST_GROUP(SoftTimersHiRes);
+#endif
+#if (SFTM_CFG_TRACE)
+  RUN_TEST_GROUP(SoftTimersTrace);
+#endif
 }
 
 /*======================================================================================*/
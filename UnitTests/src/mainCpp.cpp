@@ -0,0 +1,75 @@
+/*=======================================================================================*
+ * @file    mainCpp.cpp
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains test runner procedures for C++ unit tests.
+ *======================================================================================*/
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+/* Fixture header declares UnityMain without C linkage */
+extern "C"
+{
+#include "unity_fixture.h"
+}
+#include "SoftTimers.h"
+
+/*======================================================================================*/
+/*                           ####### TESTS GROUPS #######                               */
+/*======================================================================================*/
+TEST_GROUP_RUNNER(SoftTimersCpp)
+{
+  RUN_TEST_CASE(SoftTimersCpp, Timer_should_CallFreeFunction);
+  RUN_TEST_CASE(SoftTimersCpp, Timer_should_CallFunctionWithObjectReference);
+  RUN_TEST_CASE(SoftTimersCpp, Timer_should_CallMemberFunctionOfObject);
+  RUN_TEST_CASE(SoftTimersCpp, Timer_should_KeepRunningTimerWhenMoveConstructed);
+  RUN_TEST_CASE(SoftTimersCpp, Timer_should_ReleaseOwnSlotWhenMoveAssigned);
+  RUN_TEST_CASE(SoftTimersCpp, TimerSlot_should_ReleaseSlotInDestructor);
+#if (SFTM_CFG_INLINE_CONTEXT)
+  RUN_TEST_CASE(SoftTimersCpp, InlineTimer_should_CallLambdaWithCapturedState);
+#endif
+}
+
+#ifdef __cpp_impl_coroutine
+TEST_GROUP_RUNNER(SoftTimersCoro)
+{
+  RUN_TEST_CASE(SoftTimersCoro, SleepFor_should_ResumeCoroutineAfterDuration);
+  RUN_TEST_CASE(SoftTimersCoro, SleepFor_should_SuspendAsManyCoroutinesAsConfigured);
+  RUN_TEST_CASE(SoftTimersCoro, Timeout_should_ResumeWithFalseWhenEventIsNotSet);
+  RUN_TEST_CASE(SoftTimersCoro, Timeout_should_ResumeWithTrueAndCancelTimeoutWhenEventIsSet);
+  RUN_TEST_CASE(SoftTimersCoro, Timeout_should_NotSuspendWhenEventIsAlreadySet);
+  RUN_TEST_CASE(SoftTimersCoro, SleepFor_should_StopTimerWhenSuspendedCoroutineIsDestroyed);
+  RUN_TEST_CASE(SoftTimersCoro, Timeout_should_StopTimerAndLeaveEventWhenSuspendedCoroutineIsDestroyed);
+}
+#endif
+
+/*======================================================================================*/
+/*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
+/*======================================================================================*/
+static void RunAllTests(void);
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+static void RunAllTests(void)
+{
+  /* Wrappers release their timer slots, so module is initialized once for all tests */
+  SFTM_Init();
+
+  RUN_TEST_GROUP(SoftTimersCpp);
+#ifdef __cpp_impl_coroutine
+  RUN_TEST_GROUP(SoftTimersCoro);
+#endif
+}
+
+/*======================================================================================*/
+/*                 ####### EXPORTED FUNCTIONS DEFINITIONS #######                       */
+/*======================================================================================*/
+int main(int argc, const char * argv[])
+{
+  return UnityMain(argc, argv, RunAllTests);
+}
@@ -22,69 +22,211 @@
 /*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
 #include <stdio.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 /*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
-#include "cmsis_device.h"
+#include "SoftTimersConfig.h"
 
 /*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+#define SFTM_NO_EXPIRY                0xFFFFFFFF ///< Ticks until next expiry when no timer runs
+#define SFTM_SNAPSHOT_VERSION         1          ///< Version of timers snapshot format
+#define SFTM_NO_CALLBACK_ID           0xFF       ///< Callback ID of timer whose callback is not in callbacks table
+#define SFTM_COMPACT_MAX_TIMEOUT      0x7FFF     ///< Longest timeout of compact timer, deadline is kept in 16 bits
 
 /*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+#define SFTM_SNAPSHOT_SIZE(timersNumber)  (4u + 12u * (timersNumber))   ///< Snapshot size in bytes
+#define SFTM_STATIC_TIMER(name)           SFTM_GetTimerHandle(SFTM_STATIC_TIMER_##name)   ///< Handle of static timer
+
+#if defined(__GNUC__)
+#define SFTM_RETURNS_NONNULL              __attribute__((returns_nonnull))   ///< Function never returns NULL
+#else
+#define SFTM_RETURNS_NONNULL
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 /*======================================================================================*/
 /*                     ####### EXPORTED TYPE DECLARATIONS #######                       */
 /*======================================================================================*/
 /*---------------------------- ALL TYPE DECLARATIONS -----------------------------------*/
-typedef enum SFTM_TimerRet_Tag SFTM_TimerRet_T;
-typedef enum SFTM_TimerType_Tag SFTM_TimerType_T;
-typedef enum SFTM_TimerStatus_Tag SFTM_TimerStatus_T;
 typedef struct SFTM_Timer_Tag SFTM_Timer_T;
 typedef void (*SFTM_TimerCallback_T)(void* pContext);   ///< timer callback on expire event
+typedef void (*SFTM_BatchCallback_T)(void* const* ppContexts, uint8_t contextsNumber); ///< batch callback on expire events
 typedef uint32_t SFTM_timeoutMS;                        ///< time in ms
 typedef uint32_t SFTM_ticks;                            ///< timer ticks
 typedef SFTM_Timer_T* SFTM_TimerHandle_T;               ///< timer handle
+typedef struct SFTM_TimerGroup_Tag SFTM_TimerGroup_T;
+typedef SFTM_TimerGroup_T* SFTM_TimerGroupHandle_T;     ///< timer group handle
+typedef struct SFTM_EventQueue_Tag SFTM_EventQueue_T;
 
 /*------------------------------------- ENUMS ------------------------------------------*/
 /** @enum SFTM_TimerRet_T
  *        Timer return type enumerator for #SFTM_StartTimer.
  */
-enum SFTM_TimerRet_Tag
+typedef enum SFTM_TimerRet_Tag
 {
   SFTM_TIMER_STARTED = 0,    ///< Timer was started successfully
   SFTM_TIMER_IN_USE,         ///< Timer is already in use
-};
+} SFTM_TimerRet_T;
 
 /** @enum SFTM_TimerType_T
  *        Timer type enumerator.
  */
-enum SFTM_TimerType_Tag
+typedef enum SFTM_TimerType_Tag
 {
   SFTM_ONE_SHOT = 0,         ///< This timer type expiring only one time
   SFTM_AUTO_RELOAD,          ///< This timer type auto reloads after expiration
-};
+} SFTM_TimerType_T;
 
 /** @enum SFTM_TimerStatus_T
  *        Timers status expiration enumerator.
  */
-enum SFTM_TimerStatus_Tag
+typedef enum SFTM_TimerStatus_Tag
 {
   SFTM_NOT_EXPIRED = false,         ///< Timer is not expired
   SFTM_EXPIRED     = true           ///< Timer is expired
-};
+} SFTM_TimerStatus_T;
+
+/** @enum SFTM_TimerState_T
+ *        Timer state enumerator.
+ */
+typedef enum SFTM_TimerState_Tag
+{
+  SFTM_TIMER_IDLE = 0,              ///< Timer is not started or was stopped
+  SFTM_TIMER_RUNNING,               ///< Timer counts to its deadline
+  SFTM_TIMER_EXPIRED,               ///< Timer expired and waits for events handler
+  SFTM_TIMER_DONE,                  ///< One shot timer was dispatched, it stays in use until stopped
+  SFTM_TIMER_PARKED,                ///< Timer reached its deadline in paused group and waits for resume
+  SFTM_TIMER_PAUSED,                ///< Timer is paused and keeps its remaining ticks
+  SFTM_TIMER_FREE,                  ///< Timer slot was deleted and waits for reuse by create
+} SFTM_TimerState_T;
+
+#if (SFTM_CFG_STATIC_TIMERS)
+#define SFTM_STATIC_TIMER_INDEX(name, timerType, timeout, onExpire, pContext)  SFTM_STATIC_TIMER_##name,
+
+/** @enum SFTM_StaticTimer_T
+ *        Static timers indexes, SFTM_STATIC_TIMER_<name> for every entry of static timers list.
+ */
+typedef enum SFTM_StaticTimer_Tag
+{
+  SFTM_STATIC_TIMERS(SFTM_STATIC_TIMER_INDEX)
+} SFTM_StaticTimer_T;
+#endif
 
 /*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+/** @struct SFTM_TimerConfig_T
+ *          Timer configuration. With SFTM_CFG_ROM_DESCRIPTORS it is kept apart from timer
+ *          structure, in ROM for static timers.
+ */
+typedef struct SFTM_TimerConfig_Tag
+{
+  SFTM_TimerType_T timerType;           ///< Timer type
+  SFTM_timeoutMS timeout;               ///< Timer timeout
+  SFTM_TimerCallback_T onExpire;        ///< Pointer to function called on timer expiration event
+  void *pContext;                       ///< Pointer to context passed to callback function on expiration event
+} SFTM_TimerConfig_T;
+
 /** @struct SFTM_Timer_T
  *          Timer structure.
  */
 struct SFTM_Timer_Tag
 {
+#if (SFTM_CFG_COMPACT)
+  volatile uint16_t deadline;           ///< Low half of System tick on which timer expires, remaining ticks if paused
+  uint16_t timeout;                     ///< Timer timeout, up to SFTM_COMPACT_MAX_TIMEOUT
+  volatile uint8_t state : 3;           ///< Timer state, one of #SFTM_TimerState_T
+  volatile uint8_t queued : 1;          ///< Timer is in expired timers queue
+  uint8_t timerType : 1;                ///< Timer type
+  uint8_t heapIdx;                      ///< Position in running timers heap
+  uint8_t callbackId;                   ///< Index of callback and context in callbacks table
+#else
+#if !(SFTM_CFG_ROM_DESCRIPTORS)
   SFTM_TimerType_T timerType;           ///< Timer type
-  volatile SFTM_ticks ticks;            ///< Timer ticks
+#endif
+  volatile SFTM_ticks deadline;         ///< System tick on which timer expires, remaining ticks if paused
+#if !(SFTM_CFG_ROM_DESCRIPTORS)
   SFTM_timeoutMS timeout;               ///< Timer timeout
-  volatile bool expiredFlag;            ///< Timer expired flag - used for expiration indication
+#endif
+  volatile uint8_t state;               ///< Timer state, one of #SFTM_TimerState_T
+  uint8_t heapIdx;                      ///< Position in running timers heap
+  volatile bool queued;                 ///< Timer is in expired timers queue
+#if !(SFTM_CFG_ROM_DESCRIPTORS)
   SFTM_TimerCallback_T onExpire;        ///< Pointer to function called on timer expiration event
   void *pContext;                       ///< Pointer to context passed to callback function on expiration event
+#endif
+#endif /* SFTM_CFG_COMPACT */
+#if (SFTM_CFG_INLINE_CONTEXT)
+  union
+  {
+    uint8_t bytes[SFTM_INLINE_CONTEXT_SIZE];  ///< Context copied on start
+    uint64_t align;                     ///< Aligns storage for any scalar type
+    void *pAlign;                       ///< Aligns storage for pointers
+  } inlineContext;                      ///< Callback context storage, passed as pContext of inline started timer
+#endif
+#if (SFTM_CFG_GROUPS)
+  uint8_t group;                        ///< Index of group or 0xFF if timer is not in group
+  uint8_t nextParked;                   ///< Next timer parked in paused group
+  SFTM_ticks groupOffset;               ///< Group offset already applied to deadline
+  uint32_t groupEpoch;                  ///< Group epoch on timer start, timer is stopped if group epoch differs
+#endif
+#if (SFTM_CFG_EVENT_QUEUE)
+  SFTM_EventQueue_T *pEventQueue;       ///< Queue for expiry events or NULL if timer calls onExpire
+  uint8_t overruns;                     ///< Expiry events dropped since last posted one
+#endif
 };
 
+#if (SFTM_CFG_GROUPS)
+/** @struct SFTM_TimerGroup_T
+ *          Timer group structure. Group operations change only this structure, members apply
+ *          them lazily when they reach their deadline or are accessed.
+ */
+struct SFTM_TimerGroup_Tag
+{
+  uint32_t epoch;                       ///< Incremented when group is stopped
+  SFTM_ticks offset;                    ///< Total time group was postponed by
+  SFTM_ticks pauseTick;                 ///< System tick on which group was paused
+  bool paused;                          ///< Group is paused
+  uint8_t parkedHead;                   ///< First timer which reached its deadline during pause
+};
+#endif
+
+#if (SFTM_CFG_EVENT_QUEUE)
+/** @struct SFTM_Event_T
+ *          Timer expiry event.
+ */
+typedef struct SFTM_Event_Tag
+{
+  void *pContext;                       ///< Context of expired timer
+  uint8_t timerIdx;                     ///< Index of expired timer
+  uint8_t overruns;                     ///< Expiry events of this timer dropped before this one, saturated
+} SFTM_Event_T;
+
+/** @struct SFTM_EventQueue_T
+ *          Bounded queue of timer expiry events, its storage is supplied by application.
+ *          Events handler is its only producer, application is its only consumer.
+ */
+struct SFTM_EventQueue_Tag
+{
+  SFTM_Event_T *pEvents;                ///< Events storage
+  uint16_t size;                        ///< Events storage size, one slot is always empty
+  volatile uint16_t head;               ///< Write position
+  volatile uint16_t tail;               ///< Read position
+};
+#endif
+
+/** @struct SFTM_Callback_T
+ *          Callback with its context, also callbacks table entry. Snapshot and compact timers
+ *          refer to callback and its context by entry index, so snapshot table has to keep its
+ *          order between snapshot and restore.
+ */
+typedef struct SFTM_Callback_Tag
+{
+  SFTM_TimerCallback_T onExpire;        ///< Pointer to function called on timer expiration event
+  void *pContext;                       ///< Pointer to context passed to callback function
+} SFTM_Callback_T;
+
 /*======================================================================================*/
 /*                    ####### EXPORTED OBJECT DECLARATIONS #######                      */
 /*======================================================================================*/
@@ -95,7 +237,11 @@ struct SFTM_Timer_Tag
 /**
  * @brief Function for Timers initialization.
  *
- *        This function initializes timers.
+ *        This function initializes timers and port, it has to be called before timers are
+ *        started. Static timers are configured by their initializer and keep configuration,
+ *        only their state is reset. Statistics, if SFTM_CFG_INSTRUMENTATION or
+ *        SFTM_CFG_LATENESS is enabled, and trace buffer, if SFTM_CFG_TRACE is enabled, are
+ *        initialized too.
  *
  * @return void
  */
@@ -115,7 +261,16 @@ void SFTM_TimersHandler(void);
 /**
  * @brief Function for processing timers events.
  *
- *        This function must be invoked from main while loop.
+ *        This function must be invoked from main while loop. Expired timers are dispatched
+ *        in expiration order. Callback may start, stop, restart, pause, resume or delete any
+ *        timer, including its own:
+ *        - own timer left untouched is finished after callback, one shot timer is done and
+ *          auto reload timer is restarted,
+ *        - own timer changed by callback is left as callback set it, one started again and
+ *          expired before callback returns is dispatched again in the same call,
+ *        - other timer expired but not dispatched yet is not dispatched if callback stops or
+ *          restarts it,
+ *        - nested call from callback, also through #SFTM_Advance, returns without dispatch.
  *
  * @return void
  */
@@ -125,17 +280,35 @@ void SFTM_TimersEventsHandler(void);
 /**
  * @brief Function for create timers.
  *
- *        This function creates given timer.
+ *        This function creates given timer. When all slots were created once, slot of deleted
+ *        timer is reused. No free slot is a fault, so returned handle is never NULL.
  *
  * @return SFTM_TimerHandle_T - handle of created timer.
  */
-SFTM_TimerHandle_T SFTM_CreateTimer(void);
+SFTM_TimerHandle_T SFTM_CreateTimer(void) SFTM_RETURNS_NONNULL;
+
+
+/**
+ * @brief Function for deleting timers.
+ *
+ *        This function stops given timer and releases its slot for #SFTM_CreateTimer, timer
+ *        handle cannot be used afterwards. Static timers cannot be deleted.
+ *
+ * @param [in] timerHandle of deleted timer.
+ *
+ * @return void
+ */
+void SFTM_DeleteTimer(SFTM_TimerHandle_T timerHandle);
 
 
 /**
  * @brief Function for starting timers.
  *
- *        This function starts given timer.
+ *        This function starts given timer. Any timeout up to 0xFFFFFFFF ticks is supported, long
+ *        timeouts wait in far future tier scanned periodically and move to running timers heap
+ *        well before their deadline. With SFTM_CFG_COMPACT timeout is limited to
+ *        SFTM_COMPACT_MAX_TIMEOUT and onExpire with pContext pair is added to callbacks table
+ *        until timer is stopped, longer timeout or full table is a fault.
  *
  * @param [in] timerHandle of started timer.
  * @param [in] timerType of started timer.
@@ -147,6 +320,27 @@ SFTM_TimerHandle_T SFTM_CreateTimer(void);
 SFTM_TimerRet_T SFTM_StartTimer(SFTM_TimerHandle_T timerHandle, SFTM_TimerType_T timerType, SFTM_TimerCallback_T onExpire, void* pContext, SFTM_timeoutMS timeout);
 
 
+#if (SFTM_CFG_INLINE_CONTEXT)
+/**
+ * @brief Function for starting timer with context stored in timer.
+ *
+ *        Context is copied into timer slot and onExpire gets pointer to that copy, so
+ *        application keeps no context object and dispatch reads context next to timer.
+ *        Copy stays valid until timer is stopped or started again.
+ *
+ * @param [in] timerHandle of started timer.
+ * @param [in] timerType of started timer.
+ * @param [in] onExpire is a pointer for function called when timer expires.
+ * @param [in] pCapture points to context copied into timer.
+ * @param [in] captureSize in bytes, up to SFTM_INLINE_CONTEXT_SIZE.
+ * @param [in] timeout is a time of timer period.
+ *
+ * @return SFTM_TIMER_STARTED or SFTM_TIMER_IN_USE if timer is not stopped.
+ */
+SFTM_TimerRet_T SFTM_StartTimerInline(SFTM_TimerHandle_T timerHandle, SFTM_TimerType_T timerType, SFTM_TimerCallback_T onExpire, const void *pCapture, uint8_t captureSize, SFTM_timeoutMS timeout);
+#endif
+
+
 /**
  * @brief Function for stopping timer.
  *
@@ -171,6 +365,49 @@ void SFTM_StopTimer(SFTM_TimerHandle_T timerHandle);
 void SFTM_RestartTimer(SFTM_TimerHandle_T timerHandle);
 
 
+/**
+ * @brief Function for pausing timer.
+ *
+ *        This function freezes remaining time of running timer. Paused timer is removed from
+ *        running timers, it costs nothing until it is resumed. Expired timer, also one paused
+ *        from its own callback, is not dispatched or restarted any more and keeps its full
+ *        timeout. Stop and restart work on paused timer as on running one.
+ *
+ * @param [in] timerHandle of started timer.
+ *
+ * @return void
+ */
+void SFTM_PauseTimer(SFTM_TimerHandle_T timerHandle);
+
+
+/**
+ * @brief Function for resuming timer.
+ *
+ *        This function starts paused timer again with its remaining time.
+ *
+ * @param [in] timerHandle of paused timer.
+ *
+ * @return void
+ */
+void SFTM_ResumeTimer(SFTM_TimerHandle_T timerHandle);
+
+
+/**
+ * @brief Function for advancing timers time.
+ *
+ *        This function moves system tick forward by given number of ticks at once. Every timer due
+ *        in between expires at its own deadline and is dispatched in deadline order, auto reload
+ *        timers are reloaded as many times as needed. Cost depends on number of expirations and,
+ *        while far future timers run, on number of their tier scans, not on number of ticks.
+ *        Intended for simulations and tests, call it from main loop context.
+ *
+ * @param [in] ticks to advance.
+ *
+ * @return void
+ */
+void SFTM_Advance(SFTM_ticks ticks);
+
+
 /**
  * @brief Function for getting timer status.
  *
@@ -178,8 +415,8 @@ void SFTM_RestartTimer(SFTM_TimerHandle_T timerHandle);
  *
  * @param [in] timerHandle of started timer.
  *
- * @retval true if expired
- * @retval false if not expired
+ * @retval true if expired or stopped
+ * @retval false if running or paused
  */
 SFTM_TimerStatus_T SFTM_GetTimerStatus(SFTM_TimerHandle_T timerHandle);
 
@@ -187,15 +424,128 @@ SFTM_TimerStatus_T SFTM_GetTimerStatus(SFTM_TimerHandle_T timerHandle);
 /**
  * @brief Function to getting timer tick.
  *
- *        This function gets timer tick number.
+ *        This function gets number of ticks elapsed since timer was started or restarted. Time its
+ *        group was paused or postponed by is not counted.
  *
  * @param [in] timerHandle of started timer.
  *
- * @return timer tick number.
+ * @return timer tick number or 0xFFFFFFFF if timer is idle.
  */
 uint32_t SFTM_GetTimerTick(SFTM_TimerHandle_T timerHandle);
 
 
+#if (SFTM_CFG_SUBTICK)
+/**
+ * @brief Function for getting timer time with sub-tick precision.
+ *
+ *        This function gets time elapsed since timer was started or restarted like
+ *        #SFTM_GetTimerTick does. Part of current timers tick is counted from System tick
+ *        ISR calls and from port time source within System tick ISR period.
+ *
+ * @param [in] timerHandle of started timer.
+ *
+ * @return elapsed time in us or UINT64_MAX if timer is idle.
+ */
+uint64_t SFTM_GetTimerTimeUs(SFTM_TimerHandle_T timerHandle);
+
+
+/**
+ * @brief Function for getting timer remaining time with sub-tick precision.
+ *
+ *        This function gets time left until timer expires, it is frozen while timer or its
+ *        group is paused.
+ *
+ * @param [in] timerHandle of started timer.
+ *
+ * @return remaining time in us or 0 if timer is idle, expired or done.
+ */
+uint64_t SFTM_GetTimerRemainingUs(SFTM_TimerHandle_T timerHandle);
+#endif
+
+
+/**
+ * @brief Function for getting system tick.
+ *
+ *        This function gets number of timers ticks since start. Counter wraps around.
+ *
+ * @return system tick.
+ */
+SFTM_ticks SFTM_GetSystemTick(void);
+
+
+/**
+ * @brief Function for getting extended system tick.
+ *
+ *        This function gets number of timers ticks since start extended with number of system
+ *        tick wraparounds in upper 32 bits, it does not wrap in practice.
+ *
+ * @return extended system tick.
+ */
+uint64_t SFTM_GetSystemTick64(void);
+
+
+/**
+ * @brief Function for getting monotonic time with sub tick resolution.
+ *
+ *        This function combines extended system tick, System tick ISR calls counted within
+ *        current tick and time elapsed since last System tick ISR call reported by port. It
+ *        follows time moved by #SFTM_Advance and #SFTM_IdleSleep.
+ *
+ * @return time in ns.
+ */
+uint64_t SFTM_GetTimeNs(void);
+
+
+/**
+ * @brief Function for getting ticks until next expiry.
+ *
+ *        This function takes constant time, earliest deadline is kept on top of running timers
+ *        heap. Returned value is never later than real next expiry, it can be earlier when
+ *        earliest timer belongs to postponed group or when far future timers wait for tier scan.
+ *        High resolution timer deadline is rounded up to whole tick.
+ *
+ * @return ticks until next expiry, 0 if expired timers wait for events handler or
+ *         SFTM_NO_EXPIRY if no timer runs.
+ */
+SFTM_ticks SFTM_GetTicksUntilNextExpiry(void);
+
+
+/**
+ * @brief Function for sleeping until next expiry.
+ *
+ *        This function is intended for idle loop. It suppresses periodic System tick ISR,
+ *        sleeps with port sleep until earliest deadline or any other interrupt and credits
+ *        elapsed ticks at once on wakeup. It returns immediately if any timer is due and
+ *        sleeps until interrupt if no timer runs. Port counts part of tick elapsed before
+ *        early wakeup as System tick ISR periods. Call #SFTM_TimersEventsHandler after.
+ *
+ * @return number of slept ticks.
+ */
+SFTM_ticks SFTM_IdleSleep(void);
+
+
+/**
+ * @brief Function for getting timer handle.
+ *
+ * @param [in] timerIdx of timer slot.
+ *
+ * @return timer handle.
+ */
+SFTM_TimerHandle_T SFTM_GetTimerHandle(uint8_t timerIdx);
+
+
+/**
+ * @brief Function for getting timer index.
+ *
+ *        This function gets index of timer slot, timers are indexed in creation order.
+ *
+ * @param [in] timerHandle of timer.
+ *
+ * @return timer index.
+ */
+uint8_t SFTM_GetTimerIndex(SFTM_TimerHandle_T timerHandle);
+
+
 /**
  * @brief Function for getting current timers number in system.
  *
@@ -215,15 +565,266 @@ uint8_t SFTM_MaxTimersNumberInSystem(void);
 /**
  * @brief Function for make hard fault.
  *
- *        If your have your own hard fault implementation, call it in this function rather than current implementation.
+ *        This function calls fault hook of the port, provide your own port to change it.
  *
  * @return void
  */
-static inline void SFTM_ExecuteHardFault(void)
-{
-  void (*Fault)(void) = NULL;
-  Fault();
+void SFTM_ExecuteHardFault(void);
+
+#if (SFTM_CFG_GROUPS)
+
+/**
+ * @brief Function for create timer groups.
+ *
+ * @return SFTM_TimerGroupHandle_T - handle of created group.
+ */
+SFTM_TimerGroupHandle_T SFTM_CreateGroup(void);
+
+
+/**
+ * @brief Function for adding timer to group.
+ *
+ *        Timer has to be stopped, otherwise it is not added. Timer stays in group until it is
+ *        added to other group.
+ *
+ * @param [in] timerHandle of added timer.
+ * @param [in] groupHandle of group or NULL to remove timer from its group.
+ *
+ * @return void
+ */
+void SFTM_AddTimerToGroup(SFTM_TimerHandle_T timerHandle, SFTM_TimerGroupHandle_T groupHandle);
+
+
+/**
+ * @brief Function for stopping all timers of group.
+ *
+ *        This function takes constant time, every member is stopped on its next deadline or
+ *        API call. Timers started after this call run normally.
+ *
+ * @param [in] groupHandle of group.
+ *
+ * @return void
+ */
+void SFTM_StopGroup(SFTM_TimerGroupHandle_T groupHandle);
+
+
+/**
+ * @brief Function for pausing all timers of group.
+ *
+ *        This function takes constant time. Paused time does not count to timeouts of group
+ *        members. Pause group, start its members and resume it to start them all together.
+ *
+ * @param [in] groupHandle of group.
+ *
+ * @return void
+ */
+void SFTM_PauseGroup(SFTM_TimerGroupHandle_T groupHandle);
+
+
+/**
+ * @brief Function for resuming all timers of group.
+ *
+ *        This function touches only members which reached their deadline during pause.
+ *
+ * @param [in] groupHandle of group.
+ *
+ * @return void
+ */
+void SFTM_ResumeGroup(SFTM_TimerGroupHandle_T groupHandle);
+
+
+/**
+ * @brief Function for postponing all timers of group.
+ *
+ *        This function takes constant time, members are moved on their next deadline.
+ *
+ * @param [in] groupHandle of group.
+ * @param [in] ticks to postpone group by, lower than 0x40000000.
+ *
+ * @return void
+ */
+void SFTM_ShiftGroup(SFTM_TimerGroupHandle_T groupHandle, SFTM_ticks ticks);
+
+#endif /* SFTM_CFG_GROUPS */
+
+#if (SFTM_CFG_SNAPSHOT)
+
+/**
+ * @brief Function for saving timers snapshot.
+ *
+ *        Snapshot is versioned little endian byte stream, SFTM_SNAPSHOT_SIZE bytes for all
+ *        created timers. Every timer is saved with its type, state, timeout, ticks remaining
+ *        from now and ID of its callback, which is index of entry matching both callback and
+ *        context in callbacks table. Group membership is not saved. Snapshot is not saved
+ *        if callback and context of any timer are set and missing from callbacks table.
+ *
+ * @param [out] pBuffer for snapshot.
+ * @param [in] bufferSize in bytes.
+ * @param [in] pCallbacks is a callbacks table.
+ * @param [in] callbacksNumber in table.
+ *
+ * @return number of saved bytes or 0 if buffer is too small or callback is not in table.
+ */
+uint32_t SFTM_SaveSnapshot(uint8_t *pBuffer, uint32_t bufferSize, const SFTM_Callback_T *pCallbacks, uint8_t callbacksNumber);
+
+
+/**
+ * @brief Function for restoring timers snapshot.
+ *
+ *        Call it after #SFTM_Init instead of creating timers, static timers are overwritten
+ *        by snapshot, so none of them may be running or expired. Timers get the same slots,
+ *        so their indexes are kept. Running timers continue with their remaining ticks and
+ *        engine indexes are rebuilt in one pass. Nothing is changed if snapshot is not valid.
+ *
+ * @param [in] pBuffer with snapshot.
+ * @param [in] size of snapshot in bytes.
+ * @param [in] pCallbacks is a callbacks table.
+ * @param [in] callbacksNumber in table.
+ *
+ * @retval true if restored
+ * @retval false if snapshot is not valid, does not fit, timers are already created or static
+ *         timer is running
+ */
+bool SFTM_RestoreSnapshot(const uint8_t *pBuffer, uint32_t size, const SFTM_Callback_T *pCallbacks, uint8_t callbacksNumber);
+
+#endif /* SFTM_CFG_SNAPSHOT */
+
+#if (SFTM_CFG_STATIC_TIMERS)
+
+/**
+ * @brief Function for starting static timer.
+ *
+ *        Timer is started with type, timeout, callback and context of its declaration. With
+ *        SFTM_CFG_ROM_DESCRIPTORS it is the only way to start static timer, its configuration
+ *        cannot be changed with #SFTM_StartTimer.
+ *
+ * @param [in] timerHandle of static timer, see #SFTM_STATIC_TIMER.
+ *
+ * @return SFTM_TIMER_STARTED or SFTM_TIMER_IN_USE if timer is not stopped.
+ */
+SFTM_TimerRet_T SFTM_StartStaticTimer(SFTM_TimerHandle_T timerHandle);
+
+#endif /* SFTM_CFG_STATIC_TIMERS */
+
+#if (SFTM_CFG_EVENT_QUEUE)
+
+/**
+ * @brief Function for initialization of expiry events queue.
+ *
+ *        Hard fault is executed if size is smaller than 2.
+ *
+ * @param [out] pQueue to initialize.
+ * @param [in] pEvents is a storage for events.
+ * @param [in] size of storage, queue holds size - 1 events.
+ *
+ * @return void
+ */
+void SFTM_InitEventQueue(SFTM_EventQueue_T *pQueue, SFTM_Event_T *pEvents, uint16_t size);
+
+
+/**
+ * @brief Function for setting timer expiry events queue.
+ *
+ *        Timer with queue set does not call onExpire, events handler posts its expiry event
+ *        to the queue instead. If queue is full event is dropped and counted in overruns of
+ *        next posted event of the timer.
+ *
+ * @param [in] timerHandle of timer.
+ * @param [in] pQueue for expiry events or NULL to call onExpire again.
+ *
+ * @return void
+ */
+void SFTM_SetTimerEventQueue(SFTM_TimerHandle_T timerHandle, SFTM_EventQueue_T *pQueue);
+
+
+/**
+ * @brief Function for getting expiry event from queue.
+ *
+ * @param [in] pQueue of events.
+ * @param [out] pEvent taken from queue.
+ *
+ * @retval true if event was taken
+ * @retval false if queue is empty
+ */
+bool SFTM_GetEvent(SFTM_EventQueue_T *pQueue, SFTM_Event_T *pEvent);
+
+#endif /* SFTM_CFG_EVENT_QUEUE */
+
+#if (SFTM_CFG_BATCH)
+
+/**
+ * @brief Function for registering batch callback.
+ *
+ *        Timers expiring with onExpire equal to given callback are not dispatched one by one.
+ *        Their contexts are collected in expiration order and batch callback is called once
+ *        for them at the end of #SFTM_TimersEventsHandler. One shot timers are done and auto
+ *        reload timers are restarted before batch callback is called.
+ *
+ * @param [in] onExpire is a callback of batched timers.
+ * @param [in] onExpireBatch is a pointer for function called with all expired contexts.
+ *
+ * @retval true if registered
+ * @retval false if there is no free batch callback
+ */
+bool SFTM_RegisterBatchCallback(SFTM_TimerCallback_T onExpire, SFTM_BatchCallback_T onExpireBatch);
+
+#endif /* SFTM_CFG_BATCH */
+
+#if (SFTM_CFG_COMMAND_QUEUE)
+
+/**
+ * @brief Function for posting timer start command.
+ *
+ *        Command is applied by System tick ISR at the start of its next call, with the same
+ *        result as #SFTM_StartTimer. Posting is lock-free and can be done from any thread or
+ *        interrupt priority. System tick ISR applies commands without taking critical section,
+ *        because every writer from main context holds it. Events handler reads callback and
+ *        context of expired timer once within critical section, so command applied during
+ *        dispatch changes the next dispatch only. Command posted by producer preempted before
+ *        publishing it delays later commands until producer finishes.
+ *
+ * @param [in] timerHandle of started timer.
+ * @param [in] timerType of started timer.
+ * @param [in] onExpire is a pointer for function called when timer expires.
+ * @param [in] pContext passed to onExpire.
+ * @param [in] timeout is a time of timer period.
+ *
+ * @retval true if command was posted
+ * @retval false if command queue is full
+ */
+bool SFTM_PostStartTimer(SFTM_TimerHandle_T timerHandle, SFTM_TimerType_T timerType, SFTM_TimerCallback_T onExpire, void* pContext, SFTM_timeoutMS timeout);
+
+
+/**
+ * @brief Function for posting timer stop command.
+ *
+ *        Command has the same result as #SFTM_StopTimer, see #SFTM_PostStartTimer.
+ *
+ * @param [in] timerHandle of stopped timer.
+ *
+ * @retval true if command was posted
+ * @retval false if command queue is full
+ */
+bool SFTM_PostStopTimer(SFTM_TimerHandle_T timerHandle);
+
+
+/**
+ * @brief Function for posting timer restart command.
+ *
+ *        Command has the same result as #SFTM_RestartTimer, see #SFTM_PostStartTimer.
+ *
+ * @param [in] timerHandle of restarted timer.
+ *
+ * @retval true if command was posted
+ * @retval false if command queue is full
+ */
+bool SFTM_PostRestartTimer(SFTM_TimerHandle_T timerHandle);
+
+#endif /* SFTM_CFG_COMMAND_QUEUE */
+
+#ifdef __cplusplus
 }
+#endif
 
 /**
  * @}
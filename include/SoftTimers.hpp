@@ -0,0 +1,282 @@
+/*=======================================================================================*
+ * @file    SoftTimers.hpp
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   C++ wrapper of Soft Timers module
+ *
+ *          This file contains sftm::Timer class. Timer owns one timer slot and deletes it
+ *          in destructor, it can be moved but not copied. Callback is a template parameter,
+ *          so dispatch calls it directly from a static trampoline instead of through stored
+ *          function pointer and context cast by application. With SFTM_CFG_INLINE_CONTEXT
+ *          sftm::InlineTimer keeps lambda with its captures inside timer slot. Timeouts are
+ *          std::chrono durations rounded up to timers ticks, constant ones are converted by
+ *          compiler.
+ *          Timer object holds only timer handle and its methods are inline calls of C API.
+ *          Code of timer use through wrapper is not bigger than the same use of C API with
+ *          raw callback, which is checked by SoftTimers_BM_CppCodeSize test. Start/stop and
+ *          trampoline call times against raw C API are compared by C++ benchmark.
+ *======================================================================================*/
+/*----------------------- DEFINE TO PREVENT RECURSIVE INCLUSION ------------------------*/
+#ifndef SOFTTIMERS_HPP_
+#define SOFTTIMERS_HPP_
+
+/**
+ * @addtogroup SFTM Soft Timers Timers
+ * @{
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+#include <chrono>
+#include <type_traits>
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "SoftTimers.h"
+
+namespace sftm
+{
+
+/*======================================================================================*/
+/*                     ####### EXPORTED TYPE DECLARATIONS #######                       */
+/*======================================================================================*/
+/*---------------------------- ALL TYPE DECLARATIONS -----------------------------------*/
+using Ticks = std::chrono::duration<SFTM_ticks, std::ratio<1, TIMERS_CLK>>;   ///< timers clock ticks
+
+/*======================================================================================*/
+/*                   ####### EXPORTED FUNCTIONS DEFINITIONS #######                     */
+/*======================================================================================*/
+/**
+ * @brief Function for converting duration to timers ticks.
+ *
+ *        Duration is rounded up, so timer never expires before it.
+ *
+ * @param [in] timeout duration to convert.
+ *
+ * @return timeout in timers ticks.
+ */
+template <typename Rep, typename Period>
+constexpr SFTM_timeoutMS ToTicks(std::chrono::duration<Rep, Period> timeout)
+{
+  return std::chrono::ceil<Ticks>(timeout).count();
+}
+
+namespace detail
+{
+
+/**
+ * @brief Trampoline passed to C API as timer callback which calls callback taking no arguments.
+ */
+template <auto Callback>
+void Call(void*)
+{
+  Callback();
+}
+
+/**
+ * @brief Trampoline passed to C API as timer callback which calls callback with object given
+ *        as timer context.
+ */
+template <auto Callback, typename Object>
+void CallWith(void *pContext)
+{
+  Object &object = *static_cast<Object*>(pContext);
+
+  if constexpr (std::is_member_function_pointer_v<decltype(Callback)>)
+  {
+    (object.*Callback)();
+  }
+  else
+  {
+    Callback(object);
+  }
+}
+
+#if (SFTM_CFG_INLINE_CONTEXT)
+/**
+ * @brief Trampoline passed to C API as timer callback which calls callable copied into timer.
+ */
+template <typename Callable>
+void CallInline(void *pContext)
+{
+  (*static_cast<Callable*>(pContext))();
+}
+#endif
+
+} /* namespace detail */
+
+/*======================================================================================*/
+/*                          ####### CLASS DEFINITIONS #######                           */
+/*======================================================================================*/
+/** @class TimerSlot
+ *         Owner of one timer slot, base of timer classes which differ in callback storage.
+ */
+class TimerSlot
+{
+public:
+  TimerSlot() : timerHandle(SFTM_CreateTimer()) {}
+
+  ~TimerSlot()
+  {
+    Release();
+  }
+
+  TimerSlot(const TimerSlot&) = delete;
+  TimerSlot& operator=(const TimerSlot&) = delete;
+
+  TimerSlot(TimerSlot&& other) noexcept : timerHandle(other.timerHandle)
+  {
+    other.timerHandle = nullptr;
+  }
+
+  TimerSlot& operator=(TimerSlot&& other) noexcept
+  {
+    if (this != &other)
+    {
+      Release();
+      timerHandle = other.timerHandle;
+      other.timerHandle = nullptr;
+    }
+    else { /* Do nothing */ }
+
+    return *this;
+  }
+
+  void Stop()
+  {
+    SFTM_StopTimer(timerHandle);
+  }
+
+  void Restart()
+  {
+    SFTM_RestartTimer(timerHandle);
+  }
+
+  void Pause()
+  {
+    SFTM_PauseTimer(timerHandle);
+  }
+
+  void Resume()
+  {
+    SFTM_ResumeTimer(timerHandle);
+  }
+
+  SFTM_TimerStatus_T GetStatus() const
+  {
+    return SFTM_GetTimerStatus(timerHandle);
+  }
+
+  Ticks GetElapsed() const
+  {
+    return Ticks(SFTM_GetTimerTick(timerHandle));
+  }
+
+#if (SFTM_CFG_SUBTICK)
+  std::chrono::microseconds GetRemaining() const
+  {
+    return std::chrono::microseconds(SFTM_GetTimerRemainingUs(timerHandle));
+  }
+#endif
+
+  SFTM_TimerHandle_T GetHandle() const
+  {
+    return timerHandle;
+  }
+
+protected:
+  SFTM_TimerHandle_T timerHandle;       ///< Owned timer slot
+
+private:
+  void Release()
+  {
+    /* Moved from timer owns no slot */
+    if (timerHandle != nullptr)
+    {
+      SFTM_DeleteTimer(timerHandle);
+    }
+    else { /* Do nothing */ }
+  }
+};
+
+/** @class Timer
+ *         Timer whose callback is a template parameter.
+ *
+ *         Callback is a function taking no arguments or a reference to object, or a member
+ *         function of that object. Object is given on start and has to outlive running timer.
+ */
+template <auto Callback>
+class Timer : public TimerSlot
+{
+public:
+  /**
+   * @brief Method for starting timer whose callback takes no arguments.
+   *
+   * @param [in] timerType of started timer.
+   * @param [in] timeout of timer period.
+   *
+   * @return SFTM_TIMER_STARTED or SFTM_TIMER_IN_USE if timer is not stopped.
+   */
+  template <typename Rep, typename Period>
+  SFTM_TimerRet_T Start(SFTM_TimerType_T timerType, std::chrono::duration<Rep, Period> timeout)
+  {
+    static_assert(std::is_invocable_v<decltype(Callback)>, "Callback takes an object, start timer with it");
+
+    return SFTM_StartTimer(timerHandle, timerType, &detail::Call<Callback>, nullptr, ToTicks(timeout));
+  }
+
+  /**
+   * @brief Method for starting timer whose callback takes an object.
+   *
+   * @param [in] timerType of started timer.
+   * @param [in] timeout of timer period.
+   * @param [in] object passed to callback.
+   *
+   * @return SFTM_TIMER_STARTED or SFTM_TIMER_IN_USE if timer is not stopped.
+   */
+  template <typename Rep, typename Period, typename Object>
+  SFTM_TimerRet_T Start(SFTM_TimerType_T timerType, std::chrono::duration<Rep, Period> timeout, Object &object)
+  {
+    return SFTM_StartTimer(timerHandle, timerType, &detail::CallWith<Callback, Object>, &object, ToTicks(timeout));
+  }
+};
+
+#if (SFTM_CFG_INLINE_CONTEXT)
+/** @class InlineTimer
+ *         Timer whose callback is a callable object stored inside timer slot.
+ *
+ *         Callable, for example lambda, is copied into timer inline context on start, so it
+ *         has to be trivially copyable and fit SFTM_INLINE_CONTEXT_SIZE.
+ */
+class InlineTimer : public TimerSlot
+{
+public:
+  /**
+   * @brief Method for starting timer with callable stored in timer.
+   *
+   * @param [in] timerType of started timer.
+   * @param [in] timeout of timer period.
+   * @param [in] callable called when timer expires.
+   *
+   * @return SFTM_TIMER_STARTED or SFTM_TIMER_IN_USE if timer is not stopped.
+   */
+  template <typename Rep, typename Period, typename Callable>
+  SFTM_TimerRet_T Start(SFTM_TimerType_T timerType, std::chrono::duration<Rep, Period> timeout, const Callable &callable)
+  {
+    static_assert(sizeof(Callable) <= SFTM_INLINE_CONTEXT_SIZE, "Callable does not fit timer inline context");
+    static_assert(alignof(Callable) <= alignof(decltype(SFTM_Timer_T::inlineContext)), "Callable is overaligned");
+    static_assert(std::is_trivially_copyable_v<Callable>, "Callable is copied into timer as bytes");
+
+    return SFTM_StartTimerInline(timerHandle, timerType, &detail::CallInline<Callable>, &callable, sizeof(Callable), ToTicks(timeout));
+  }
+};
+#endif /* SFTM_CFG_INLINE_CONTEXT */
+
+} /* namespace sftm */
+
+/**
+ * @}
+ */
+
+#endif /* SOFTTIMERS_HPP_ */
@@ -0,0 +1,200 @@
+/*=======================================================================================*
+ * @file    SoftTimersConfig.h
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   Configuration file for Soft Timers module
+ *
+ *          This file contains configuration of Soft Timers module. Every value can be
+ *          overridden from the build system with -D option.
+ *======================================================================================*/
+/*----------------------- DEFINE TO PREVENT RECURSIVE INCLUSION ------------------------*/
+#ifndef SOFTTIMERSCONFIG_H_
+#define SOFTTIMERSCONFIG_H_
+
+/**
+ * @addtogroup SFTM Soft Timers Timers
+ * @{
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+/** @name Timers module configuration.
+ *        Configure System Tick ISR Clock, Timers Clock and some other things.
+ */
+/**@{*/
+#ifndef SYSTEM_TICK_ISR_CLK
+#define SYSTEM_TICK_ISR_CLK           1000000    ///< System Tick ISR Clock in Hz
+#endif
+#ifndef TIMERS_CLK
+#define TIMERS_CLK                    1000       ///< Timers Clock in Hz
+#endif
+#ifndef MAX_TIMER_SLOTS
+#define MAX_TIMER_SLOTS               (SFTM_STATIC_TIMERS_NUMBER + SFTM_DYNAMIC_TIMER_SLOTS)  ///< Adjust this value according to your needs
+#endif
+/**@}*/
+
+/** @name Timers module optional features.
+ *        Set to 1 to compile feature in, disabled features cost neither code nor RAM.
+ */
+/**@{*/
+#ifndef SFTM_CFG_INSTRUMENTATION
+#define SFTM_CFG_INSTRUMENTATION      0          ///< Callbacks and handler execution time histograms
+#endif
+#ifndef SFTM_CFG_LATENESS
+#define SFTM_CFG_LATENESS             0          ///< Expiry to dispatch lateness statistics
+#endif
+#ifndef SFTM_CFG_TRACE
+#define SFTM_CFG_TRACE                0          ///< Binary events trace ring buffer
+#endif
+#ifndef SFTM_CFG_HIRES
+#define SFTM_CFG_HIRES                0          ///< Microsecond resolution timers on 64-bit time base
+#endif
+#ifndef SFTM_CFG_GROUPS
+#define SFTM_CFG_GROUPS               0          ///< Timer groups with collective stop, pause, resume and shift
+#endif
+#ifndef SFTM_CFG_SNAPSHOT
+#define SFTM_CFG_SNAPSHOT             0          ///< Timers state snapshot and restore for warm restart
+#endif
+#ifndef SFTM_CFG_BATCH
+#define SFTM_CFG_BATCH                0          ///< Batch callbacks called once for all timers sharing handler
+#endif
+#ifndef SFTM_CFG_EVENT_QUEUE
+#define SFTM_CFG_EVENT_QUEUE          0          ///< Expiry events posted to application queue instead of callbacks
+#endif
+#ifndef SFTM_CFG_STATIC_TIMERS
+#define SFTM_CFG_STATIC_TIMERS        0          ///< Timers declared at compile time in SFTM_STATIC_TIMERS_FILE
+#endif
+#ifndef SFTM_CFG_ROM_DESCRIPTORS
+#define SFTM_CFG_ROM_DESCRIPTORS      0          ///< Static timers configuration kept in ROM, timer slot keeps runtime state only
+#endif
+#ifndef SFTM_CFG_COMPACT
+#define SFTM_CFG_COMPACT              0          ///< Packed timer slot with 16-bit ticks and callbacks table index
+#endif
+#ifndef SFTM_CFG_INLINE_CONTEXT
+#define SFTM_CFG_INLINE_CONTEXT       0          ///< Callback context copied into storage inside timer slot
+#endif
+#ifndef SFTM_CFG_COMMAND_QUEUE
+#define SFTM_CFG_COMMAND_QUEUE        0          ///< Lock-free posting of timer commands applied by System tick ISR
+#endif
+#ifndef SFTM_CFG_SUBTICK
+#define SFTM_CFG_SUBTICK              0          ///< Timer time queries in us interpolated between ticks by port time source
+#endif
+/**@}*/
+
+/** @name Static timers configuration.
+ *        Static timers file declares callbacks of static timers and defines X macro list
+ *        SFTM_STATIC_TIMERS(TIMER) with TIMER(name, timerType, timeout, onExpire, pContext)
+ *        entry per timer. Static timers take first slots and need no create calls.
+ */
+/**@{*/
+#if (SFTM_CFG_STATIC_TIMERS)
+  #ifndef SFTM_STATIC_TIMERS_FILE
+  #define SFTM_STATIC_TIMERS_FILE     "SoftTimersStatic.h"  ///< Header with static timers list
+  #endif
+  #include SFTM_STATIC_TIMERS_FILE
+  #define SFTM_COUNT_STATIC_TIMER(name, timerType, timeout, onExpire, pContext)  + 1
+  #define SFTM_STATIC_TIMERS_NUMBER   (0 SFTM_STATIC_TIMERS(SFTM_COUNT_STATIC_TIMER))   ///< Number of static timers
+  #ifndef SFTM_DYNAMIC_TIMER_SLOTS
+  #define SFTM_DYNAMIC_TIMER_SLOTS    0          ///< Slots for created timers, static timers table is sized exactly
+  #endif
+#else
+  #define SFTM_STATIC_TIMERS_NUMBER   0          ///< Number of static timers
+  #ifndef SFTM_DYNAMIC_TIMER_SLOTS
+  #define SFTM_DYNAMIC_TIMER_SLOTS    8          ///< Slots for created timers
+  #endif
+#endif
+/**@}*/
+
+/** @name Batch callbacks configuration.
+ */
+/**@{*/
+#ifndef MAX_BATCH_CALLBACKS
+#define MAX_BATCH_CALLBACKS           4          ///< Number of batch callbacks
+#endif
+/**@}*/
+
+/** @name Inline context configuration.
+ */
+/**@{*/
+#ifndef SFTM_INLINE_CONTEXT_SIZE
+#define SFTM_INLINE_CONTEXT_SIZE      16         ///< Inline context storage size in bytes, multiple of 8
+#endif
+/**@}*/
+
+/** @name Command queue configuration.
+ */
+/**@{*/
+#ifndef SFTM_COMMAND_QUEUE_SIZE
+#define SFTM_COMMAND_QUEUE_SIZE       16         ///< Number of pending timer commands, power of 2
+#endif
+/**@}*/
+
+/** @name C++ coroutines configuration.
+ *        Every coroutine suspended by sftm::sleep_for or sftm::timeout holds one timer
+ *        created from dynamic timer slots. Timers are kept for reuse, so pool takes up to
+ *        SFTM_CORO_MAX_AWAITS slots. Await beyond that number executes hard fault.
+ */
+/**@{*/
+#ifndef SFTM_CORO_MAX_AWAITS
+#define SFTM_CORO_MAX_AWAITS          4          ///< Number of simultaneously suspended awaits
+#endif
+/**@}*/
+
+/** @name Compact timers configuration.
+ *        Compact timer refers to its callback and context by index of shared callbacks
+ *        table, pair is added to table on timer start and its entry is reused when the last
+ *        timer referring to it is stopped or deleted.
+ */
+/**@{*/
+#ifndef MAX_COMPACT_CALLBACKS
+#define MAX_COMPACT_CALLBACKS         16         ///< Number of distinct pairs of not stopped timers
+#endif
+/**@}*/
+
+#if (SFTM_CFG_ROM_DESCRIPTORS) && !(SFTM_CFG_STATIC_TIMERS)
+  #error "ROM descriptors are used by static timers only! Please enable SFTM_CFG_STATIC_TIMERS."
+#endif
+
+#if (SFTM_CFG_COMPACT) && ((SFTM_CFG_GROUPS) || (SFTM_CFG_STATIC_TIMERS))
+  #error "Compact timers cannot be used with timer groups or static timers!"
+#endif
+
+/** @name Timer groups configuration.
+ */
+/**@{*/
+#ifndef MAX_TIMER_GROUPS
+#define MAX_TIMER_GROUPS              4          ///< Number of timer groups
+#endif
+/**@}*/
+
+/** @name Timers high resolution configuration.
+ */
+/**@{*/
+#ifndef MAX_HIRES_TIMER_SLOTS
+#define MAX_HIRES_TIMER_SLOTS         4          ///< Number of high resolution timers
+#endif
+/**@}*/
+
+/** @name Timers statistics configuration.
+ */
+/**@{*/
+#ifndef SFTM_STATS_HISTOGRAM_BUCKETS
+#define SFTM_STATS_HISTOGRAM_BUCKETS  24         ///< Number of log2 histogram buckets, last one collects overflows
+#endif
+/**@}*/
+
+/** @name Timers trace configuration.
+ */
+/**@{*/
+#ifndef SFTM_TRACE_BUFFER_SIZE
+#define SFTM_TRACE_BUFFER_SIZE        256        ///< Number of trace records, must be power of 2
+#endif
+/**@}*/
+
+/**
+ * @}
+ */
+
+#endif /* SOFTTIMERSCONFIG_H_ */
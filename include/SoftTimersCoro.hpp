@@ -0,0 +1,259 @@
+/*=======================================================================================*
+ * @file    SoftTimersCoro.hpp
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   Header file for Soft Timers C++20 coroutine awaitables
+ *
+ *          This file contains awaitables which suspend a coroutine on a soft timer:
+ *          co_await sftm::sleep_for(10ms) and co_await sftm::timeout(event, 50ms).
+ *          Suspended coroutines are resumed from SFTM_TimersEventsHandler. Durations are
+ *          rounded up to timers ticks by sftm::ToTicks. Number of simultaneously suspended
+ *          awaits is limited by SFTM_CORO_MAX_AWAITS from SoftTimersConfig.h. Coroutine
+ *          destroyed while suspended stops its timer and leaves its event without waiter.
+ *======================================================================================*/
+/*----------------------- DEFINE TO PREVENT RECURSIVE INCLUSION ------------------------*/
+#ifndef SOFTTIMERSCORO_HPP_
+#define SOFTTIMERSCORO_HPP_
+
+/**
+ * @addtogroup SFTM Soft Timers Timers
+ * @{
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+#include <chrono>
+#include <coroutine>
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "SoftTimers.hpp"
+
+/*======================================================================================*/
+/*                     ####### EXPORTED TYPE DECLARATIONS #######                       */
+/*======================================================================================*/
+namespace sftm
+{
+
+namespace detail
+{
+
+/**
+ * @brief Function for acquiring timer used by an awaitable.
+ *
+ *        Timers are created on demand up to SFTM_CORO_MAX_AWAITS and are reused after they were stopped.
+ *        Acquired timer is started as one shot timer with given callback and context. Hard fault is
+ *        executed if all timers are in use.
+ *
+ * @return handle of started timer.
+ */
+inline SFTM_TimerHandle_T StartAwaitTimer(SFTM_TimerCallback_T onExpire, void* pContext, SFTM_timeoutMS timeout)
+{
+  static SFTM_TimerHandle_T AwaitTimers[SFTM_CORO_MAX_AWAITS];
+  static uint8_t AwaitTimersNumber = 0;
+
+  for (uint8_t timerCnt = 0; timerCnt < AwaitTimersNumber; timerCnt++)
+  {
+    if (SFTM_TIMER_STARTED == SFTM_StartTimer(AwaitTimers[timerCnt], SFTM_ONE_SHOT, onExpire, pContext, timeout))
+    {
+      return AwaitTimers[timerCnt];
+    }
+  }
+
+  if (AwaitTimersNumber < SFTM_CORO_MAX_AWAITS)
+  {
+    SFTM_TimerHandle_T timer = SFTM_CreateTimer();
+    AwaitTimers[AwaitTimersNumber++] = timer;
+    SFTM_StartTimer(timer, SFTM_ONE_SHOT, onExpire, pContext, timeout);
+    return timer;
+  }
+
+  SFTM_ExecuteHardFault();
+  return NULL;
+}
+
+} // namespace detail
+
+/**
+ * @class SleepAwaiter
+ *        Awaitable which resumes coroutine after given timeout.
+ *
+ *        Awaiter lives in the coroutine frame and is passed to the timer as pContext,
+ *        so no allocation happens per await.
+ */
+class SleepAwaiter
+{
+public:
+  explicit SleepAwaiter(SFTM_timeoutMS timeout) : timeout(timeout), timer(NULL), coroutine() {}
+
+  ~SleepAwaiter()
+  {
+    /* Timer is still held only if coroutine is destroyed while suspended */
+    if (timer != NULL)
+    {
+      SFTM_StopTimer(timer);
+    }
+  }
+
+  bool await_ready() const noexcept { return 0 == timeout; }
+
+  void await_suspend(std::coroutine_handle<> awaitingCoroutine)
+  {
+    coroutine = awaitingCoroutine;
+    timer = detail::StartAwaitTimer(OnExpire, this, timeout);
+  }
+
+  void await_resume() const noexcept {}
+
+private:
+  static void OnExpire(void* pContext)
+  {
+    SleepAwaiter *self = static_cast<SleepAwaiter*>(pContext);
+
+    /* Release timer before resume, coroutine may await again */
+    SFTM_StopTimer(self->timer);
+    self->timer = NULL;
+    self->coroutine.resume();
+  }
+
+  SFTM_timeoutMS timeout;
+  SFTM_TimerHandle_T timer;
+  std::coroutine_handle<> coroutine;
+};
+
+class TimeoutAwaiter;
+
+/**
+ * @class Event
+ *        Single waiter event which completes an operation awaited with #timeout.
+ *
+ *        Event has to be set from the same context as SFTM_TimersEventsHandler is called.
+ */
+class Event
+{
+public:
+  constexpr Event() : signaled(false), pWaiter(nullptr) {}
+  Event(const Event&) = delete;
+  Event& operator=(const Event&) = delete;
+
+  void Set();
+  void Reset() { signaled = false; }
+  bool IsSet() const { return signaled; }
+
+private:
+  friend class TimeoutAwaiter;
+
+  bool signaled;
+  TimeoutAwaiter *pWaiter;
+};
+
+/**
+ * @class TimeoutAwaiter
+ *        Awaitable which resumes coroutine when event is set or timeout elapses.
+ *
+ *        co_await returns true if the event was set, false on timeout.
+ */
+class TimeoutAwaiter
+{
+public:
+  TimeoutAwaiter(Event& event, SFTM_timeoutMS timeout)
+    : event(event), timeout(timeout), timer(NULL), coroutine(), timedOut(false) {}
+
+  ~TimeoutAwaiter()
+  {
+    /* Timer is still held only if coroutine is destroyed while suspended */
+    if (timer != NULL)
+    {
+      SFTM_StopTimer(timer);
+      event.pWaiter = nullptr;
+    }
+  }
+
+  bool await_ready() const noexcept { return event.signaled; }
+
+  void await_suspend(std::coroutine_handle<> awaitingCoroutine)
+  {
+    coroutine = awaitingCoroutine;
+    event.pWaiter = this;
+    timer = detail::StartAwaitTimer(OnExpire, this, timeout);
+  }
+
+  bool await_resume() const noexcept { return !timedOut; }
+
+private:
+  friend class Event;
+
+  static void OnExpire(void* pContext)
+  {
+    TimeoutAwaiter *self = static_cast<TimeoutAwaiter*>(pContext);
+
+    SFTM_StopTimer(self->timer);
+    self->timer = NULL;
+    self->event.pWaiter = nullptr;
+    self->timedOut = true;
+    self->coroutine.resume();
+  }
+
+  void OnEvent()
+  {
+    SFTM_StopTimer(timer);
+    timer = NULL;
+    event.pWaiter = nullptr;
+    coroutine.resume();
+  }
+
+  Event &event;
+  SFTM_timeoutMS timeout;
+  SFTM_TimerHandle_T timer;
+  std::coroutine_handle<> coroutine;
+  bool timedOut;
+};
+
+inline void Event::Set()
+{
+  signaled = true;
+
+  if (pWaiter != nullptr)
+  {
+    pWaiter->OnEvent();
+  }
+}
+
+/*======================================================================================*/
+/*                   ####### EXPORTED FUNCTIONS PROTOTYPES #######                      */
+/*======================================================================================*/
+/**
+ * @brief Function for suspending coroutine for given time.
+ *
+ * @param [in] duration of sleep, rounded up to timers ticks.
+ *
+ * @return awaitable object.
+ */
+template <typename Rep, typename Period>
+SleepAwaiter sleep_for(std::chrono::duration<Rep, Period> duration)
+{
+  return SleepAwaiter(ToTicks(duration));
+}
+
+/**
+ * @brief Function for awaiting event with timeout.
+ *
+ * @param [in] event which completes awaited operation.
+ * @param [in] duration after which waiting is abandoned.
+ *
+ * @return awaitable object, co_await yields true if event was set or false on timeout.
+ */
+template <typename Rep, typename Period>
+TimeoutAwaiter timeout(Event& event, std::chrono::duration<Rep, Period> duration)
+{
+  return TimeoutAwaiter(event, ToTicks(duration));
+}
+
+} // namespace sftm
+
+/**
+ * @}
+ */
+
+#endif /* SOFTTIMERSCORO_HPP_ */
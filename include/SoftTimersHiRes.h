@@ -0,0 +1,223 @@
+/*=======================================================================================*
+ * @file    SoftTimersHiRes.h
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   Header file for Soft Timers high resolution timers
+ *
+ *          This file contains API of high resolution timers. Their timeouts are given in
+ *          microseconds and deadlines are kept in ns on engine time of #SFTM_GetTimeNs, so
+ *          they follow #SFTM_Advance and #SFTM_IdleSleep like other timers. Running timers
+ *          are ordered by deadline and the earliest one is armed on port one-shot compare
+ *          with #SFTM_PortStartCompare, whose ISR calls #SFTM_HiResCompareHandler. System
+ *          tick ISR compares the earliest deadline as well, so on port without compare
+ *          resolution is limited by SYSTEM_TICK_ISR_CLK. Timers are compiled in only if
+ *          SFTM_CFG_HIRES is enabled.
+ *======================================================================================*/
+/*----------------------- DEFINE TO PREVENT RECURSIVE INCLUSION ------------------------*/
+#ifndef SOFTTIMERSHIRES_H_
+#define SOFTTIMERSHIRES_H_
+
+/**
+ * @addtogroup SFTM Soft Timers Timers
+ * @{
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "SoftTimers.h"
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if (SFTM_CFG_HIRES)
+
+/*======================================================================================*/
+/*                     ####### EXPORTED TYPE DECLARATIONS #######                       */
+/*======================================================================================*/
+/*---------------------------- ALL TYPE DECLARATIONS -----------------------------------*/
+typedef struct SFTM_HiResTimer_Tag SFTM_HiResTimer_T;
+typedef uint32_t SFTM_timeoutUS;                          ///< time in us
+typedef uint64_t SFTM_timeUS;                             ///< monotonic time in us
+typedef SFTM_HiResTimer_T* SFTM_HiResTimerHandle_T;       ///< high resolution timer handle
+
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+/** @struct SFTM_HiResTimer_T
+ *          High resolution timer structure.
+ */
+struct SFTM_HiResTimer_Tag
+{
+  SFTM_TimerType_T timerType;           ///< Timer type
+  volatile uint64_t deadline;           ///< Engine time in ns on which timer expires
+  uint32_t period;                      ///< Timer period in us
+  volatile uint8_t state;               ///< Timer state, one of #SFTM_TimerState_T
+  uint8_t heapIdx;                      ///< Position in running timers heap
+  volatile bool queued;                 ///< Timer is in expired timers queue
+  volatile bool expiryPending;          ///< Expiry waits for dispatch, cleared on stop and start
+  SFTM_TimerCallback_T onExpire;        ///< Pointer to function called on timer expiration event
+  void *pContext;                       ///< Pointer to context passed to callback function on expiration event
+};
+
+/*======================================================================================*/
+/*                   ####### EXPORTED FUNCTIONS PROTOTYPES #######                      */
+/*======================================================================================*/
+/**
+ * @brief Function for high resolution timers initialization.
+ *
+ *        This function is called from #SFTM_Init, it stops all timers and starts time counted
+ *        by #SFTM_GetTimeUS.
+ *
+ * @return void
+ */
+void SFTM_HiResInit(void);
+
+
+/**
+ * @brief Function for counting down System tick ISR calls to the earliest deadline.
+ *
+ *        This function is called from #SFTM_TimersHandler on every System tick ISR, so
+ *        engine time for #SFTM_HiResTimersHandler is computed only when deadline is due.
+ *
+ * @return true if the earliest deadline may be due.
+ */
+bool SFTM_HiResIsDue(void);
+
+
+/**
+ * @brief Function for handling high resolution timers.
+ *
+ *        This function is called within critical section from #SFTM_TimersHandler when
+ *        #SFTM_HiResIsDue and after time is moved by #SFTM_Advance or #SFTM_IdleSleep.
+ *
+ * @param [in] timeNs is engine time of the call.
+ *
+ * @return void
+ */
+void SFTM_HiResTimersHandler(uint64_t timeNs);
+
+
+/**
+ * @brief Function for handling port one-shot compare.
+ *
+ *        This function is called from compare ISR armed by #SFTM_PortStartCompare, it
+ *        expires due timers or arms compare again for the earliest deadline. Compare ISR
+ *        must have priority of System tick ISR.
+ *
+ * @return void
+ */
+void SFTM_HiResCompareHandler(void);
+
+
+/**
+ * @brief Function for processing high resolution timers events.
+ *
+ *        This function is called from #SFTM_TimersEventsHandler.
+ *
+ * @return void
+ */
+void SFTM_HiResEventsHandler(void);
+
+
+/**
+ * @brief Function for checking if expired timers wait for events handler.
+ *
+ *        This function is called within critical section from #SFTM_GetTicksUntilNextExpiry.
+ *
+ * @return true if any timer waits for events handler.
+ */
+bool SFTM_HiResHasExpiredTimers(void);
+
+
+/**
+ * @brief Function for getting time until next high resolution timer deadline.
+ *
+ *        This function is called within critical section from #SFTM_GetTicksUntilNextExpiry
+ *        and #SFTM_Advance, which round result up to whole timers ticks.
+ *
+ * @param [in] timeNs is engine time of the call.
+ *
+ * @return time until next deadline in ns, 0 if it is due or UINT64_MAX if no timer runs.
+ */
+uint64_t SFTM_HiResGetTimeUntilNextDeadline(uint64_t timeNs);
+
+
+/**
+ * @brief Function for create high resolution timers.
+ *
+ * @return SFTM_HiResTimerHandle_T - handle of created timer.
+ */
+SFTM_HiResTimerHandle_T SFTM_CreateHiResTimer(void);
+
+
+/**
+ * @brief Function for starting high resolution timers.
+ *
+ *        Timer expires on port compare or on the first System tick ISR at or after its
+ *        deadline. #SFTM_Advance and #SFTM_IdleSleep move time in whole timers ticks, so
+ *        deadline within a tick expires at the end of that tick. Auto reload timer is
+ *        reloaded from its previous deadline, so its period does not drift when events
+ *        handler is late. Expirations missed while callback is pending are merged.
+ *
+ * @param [in] timerHandle of started timer.
+ * @param [in] timerType of started timer.
+ * @param [in] onExpire is a pointer for function called when timer expires.
+ * @param [in] pContext passed to onExpire.
+ * @param [in] timeout is a time of timer period in us, 0 is taken as 1 us.
+ *
+ * @return SFTM_TIMER_STARTED or SFTM_TIMER_IN_USE if timer is not stopped.
+ */
+SFTM_TimerRet_T SFTM_StartHiResTimer(SFTM_HiResTimerHandle_T timerHandle, SFTM_TimerType_T timerType, SFTM_TimerCallback_T onExpire, void* pContext, SFTM_timeoutUS timeout);
+
+
+/**
+ * @brief Function for stopping high resolution timer.
+ *
+ * @param [in] timerHandle of started timer.
+ *
+ * @return void
+ */
+void SFTM_StopHiResTimer(SFTM_HiResTimerHandle_T timerHandle);
+
+
+/**
+ * @brief Function for getting high resolution timer status.
+ *
+ * @param [in] timerHandle of started timer.
+ *
+ * @retval true if expired or not running
+ * @retval false if not expired
+ */
+SFTM_TimerStatus_T SFTM_GetHiResTimerStatus(SFTM_HiResTimerHandle_T timerHandle);
+
+
+/**
+ * @brief Function for getting monotonic time.
+ *
+ *        Time is counted by #SFTM_GetTimeNs since #SFTM_Init, so it is moved by #SFTM_Advance
+ *        and #SFTM_IdleSleep as well.
+ *
+ * @return time in us.
+ */
+SFTM_timeUS SFTM_GetTimeUS(void);
+
+#endif /* SFTM_CFG_HIRES */
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* SOFTTIMERSHIRES_H_ */
@@ -0,0 +1,219 @@
+/*=======================================================================================*
+ * @file    SoftTimersStats.h
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   Header file for Soft Timers statistics
+ *
+ *          This file contains API of Soft Timers statistics. Execution time histograms
+ *          are collected if SFTM_CFG_INSTRUMENTATION is enabled, expiry to dispatch
+ *          lateness histograms if SFTM_CFG_LATENESS is enabled.
+ *======================================================================================*/
+/*----------------------- DEFINE TO PREVENT RECURSIVE INCLUSION ------------------------*/
+#ifndef SOFTTIMERSSTATS_H_
+#define SOFTTIMERSSTATS_H_
+
+/**
+ * @addtogroup SFTM Soft Timers Timers
+ * @{
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+#include <stdint.h>
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "SoftTimers.h"
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if (SFTM_CFG_INSTRUMENTATION || SFTM_CFG_LATENESS)
+
+/*======================================================================================*/
+/*                     ####### EXPORTED TYPE DECLARATIONS #######                       */
+/*======================================================================================*/
+/*---------------------------- ALL TYPE DECLARATIONS -----------------------------------*/
+typedef struct SFTM_Histogram_Tag SFTM_Histogram_T;
+
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+/** @struct SFTM_Histogram_T
+ *          Log2 histogram. Bucket 0 counts zero values, bucket n counts values from 2^(n-1) to 2^n - 1.
+ */
+struct SFTM_Histogram_Tag
+{
+  uint32_t buckets[SFTM_STATS_HISTOGRAM_BUCKETS];   ///< Samples number in each bucket
+  uint32_t samples;                                 ///< Total samples number
+  uint32_t maxValue;                                ///< Maximal recorded value
+  uint64_t sum;                                     ///< Sum of recorded values
+};
+
+/*======================================================================================*/
+/*                   ####### EXPORTED FUNCTIONS PROTOTYPES #######                      */
+/*======================================================================================*/
+/**
+ * @brief Function for statistics initialization.
+ *
+ *        This function initializes time source of the port and clears all histograms. The same
+ *        is done by SFTM_Init, so it is needed only if statistics are used without timers.
+ *
+ * @return void
+ */
+void SFTM_StatsInit(void);
+
+
+/**
+ * @brief Function for clearing all histograms.
+ *
+ * @return void
+ */
+void SFTM_StatsReset(void);
+
+
+/**
+ * @brief Function for getting percentile from histogram.
+ *
+ * @param [in] pHistogram to analyze.
+ * @param [in] percent of samples which are lower or equal to returned value.
+ *
+ * @return upper bound of bucket which contains requested percentile.
+ */
+uint32_t SFTM_StatsGetPercentile(const SFTM_Histogram_T *pHistogram, uint8_t percent);
+
+
+/**
+ * @brief Function for getting mean value from histogram.
+ *
+ * @param [in] pHistogram to analyze.
+ *
+ * @return mean of recorded values or 0 if histogram is empty.
+ */
+uint32_t SFTM_StatsGetMean(const SFTM_Histogram_T *pHistogram);
+
+#endif /* SFTM_CFG_INSTRUMENTATION || SFTM_CFG_LATENESS */
+
+#if (SFTM_CFG_INSTRUMENTATION)
+
+/**
+ * @brief Function for getting timestamp.
+ *
+ *        Time source of the port is used, DWT cycle counter on Cortex-M and monotonic
+ *        clock in ns on POSIX. Define SFTM_STATS_GET_CYCLES() to use other time source.
+ *
+ * @return current timestamp.
+ */
+uint32_t SFTM_StatsGetCycles(void);
+
+
+/**
+ * @brief Function for recording timers handler execution time.
+ *
+ * @param [in] cycles spent in timers handler.
+ *
+ * @return void
+ */
+void SFTM_StatsRecordTick(uint32_t cycles);
+
+
+/**
+ * @brief Function for recording callback execution time.
+ *
+ * @param [in] timerIdx of timer which callback was called.
+ * @param [in] cycles spent in callback.
+ *
+ * @return void
+ */
+void SFTM_StatsRecordCallback(uint8_t timerIdx, uint32_t cycles);
+
+
+/**
+ * @brief Function for getting timers handler execution time histogram.
+ *
+ * @return pointer to histogram.
+ */
+const SFTM_Histogram_T* SFTM_StatsGetTickHistogram(void);
+
+
+/**
+ * @brief Function for getting callback execution time histogram of given timer.
+ *
+ * @param [in] timerHandle of timer.
+ *
+ * @return pointer to histogram.
+ */
+const SFTM_Histogram_T* SFTM_StatsGetCallbackHistogram(SFTM_TimerHandle_T timerHandle);
+
+#endif /* SFTM_CFG_INSTRUMENTATION */
+
+#if (SFTM_CFG_LATENESS)
+
+/**
+ * @brief Function for recording timer expiration.
+ *
+ *        This function is called from timers handler when timer expires.
+ *
+ * @param [in] timerIdx of expired timer.
+ * @param [in] time of expiration in System tick ISR periods.
+ *
+ * @return void
+ */
+void SFTM_StatsRecordExpiry(uint8_t timerIdx, uint32_t time);
+
+
+/**
+ * @brief Function for recording timer dispatch.
+ *
+ *        This function is called from events handler before callback of expired timer.
+ *
+ * @param [in] timerIdx of dispatched timer.
+ * @param [in] time of dispatch in System tick ISR periods.
+ *
+ * @return void
+ */
+void SFTM_StatsRecordDispatch(uint8_t timerIdx, uint32_t time);
+
+
+/**
+ * @brief Function for getting lateness of currently dispatched timer.
+ *
+ *        Call it from timer callback to get time elapsed since the timer expired.
+ *
+ * @return lateness in System tick ISR periods.
+ */
+uint32_t SFTM_StatsGetDispatchLateness(void);
+
+
+/**
+ * @brief Function for getting lateness histogram of given timer.
+ *
+ * @param [in] timerHandle of timer.
+ *
+ * @return pointer to histogram of lateness in System tick ISR periods.
+ */
+const SFTM_Histogram_T* SFTM_StatsGetLatenessHistogram(SFTM_TimerHandle_T timerHandle);
+
+
+/**
+ * @brief Function for getting lateness histogram of all timers.
+ *
+ * @return pointer to histogram of lateness in System tick ISR periods.
+ */
+const SFTM_Histogram_T* SFTM_StatsGetGlobalLatenessHistogram(void);
+
+#endif /* SFTM_CFG_LATENESS */
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* SOFTTIMERSSTATS_H_ */
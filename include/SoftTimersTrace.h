@@ -0,0 +1,144 @@
+/*=======================================================================================*
+ * @file    SoftTimersTrace.h
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   Header file for Soft Timers trace
+ *
+ *          This file contains API of Soft Timers binary events trace. Events are written
+ *          into preallocated ring buffer which can be dumped as raw memory and decoded
+ *          on host with TraceDecoder tool. Trace is compiled in only if SFTM_CFG_TRACE
+ *          is enabled.
+ *======================================================================================*/
+/*----------------------- DEFINE TO PREVENT RECURSIVE INCLUSION ------------------------*/
+#ifndef SOFTTIMERSTRACE_H_
+#define SOFTTIMERSTRACE_H_
+
+/**
+ * @addtogroup SFTM Soft Timers Timers
+ * @{
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+#include <stdint.h>
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "SoftTimersConfig.h"
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+#define SFTM_TRACE_MAGIC              0x52544653 ///< Trace buffer magic number, "SFTR" in memory
+#define SFTM_TRACE_VERSION            1          ///< Trace buffer layout version
+#define SFTM_TRACE_NO_TIMER           0xFF       ///< Timer index of events not related to any timer
+
+#if (SFTM_TRACE_BUFFER_SIZE & (SFTM_TRACE_BUFFER_SIZE - 1)) || (SFTM_TRACE_BUFFER_SIZE > 0x8000)
+  #error "Trace buffer size must be power of 2 and not greater than 32768."
+#endif
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*======================================================================================*/
+/*                     ####### EXPORTED TYPE DECLARATIONS #######                       */
+/*======================================================================================*/
+/*---------------------------- ALL TYPE DECLARATIONS -----------------------------------*/
+typedef struct SFTM_TraceRecord_Tag SFTM_TraceRecord_T;
+typedef struct SFTM_TraceBuffer_Tag SFTM_TraceBuffer_T;
+
+/*------------------------------------- ENUMS ------------------------------------------*/
+/** @enum SFTM_TraceEvent_T
+ *        Trace event enumerator.
+ */
+typedef enum SFTM_TraceEvent_Tag
+{
+  SFTM_TRACE_START = 0,      ///< Timer was started
+  SFTM_TRACE_STOP,           ///< Timer was stopped
+  SFTM_TRACE_RESTART,        ///< Timer was restarted
+  SFTM_TRACE_EXPIRE,         ///< Timer expired in timers handler
+  SFTM_TRACE_DISPATCH_BEGIN, ///< Timer callback is going to be called
+  SFTM_TRACE_DISPATCH_END,   ///< Timer callback returned
+  SFTM_TRACE_EVENTS_NUMBER
+} SFTM_TraceEvent_T;
+
+/*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+/** @struct SFTM_TraceRecord_T
+ *          Trace record, 8 bytes in little endian.
+ */
+struct SFTM_TraceRecord_Tag
+{
+  uint32_t tick;                        ///< Timers tick of event
+  uint16_t subTick;                     ///< System tick ISR calls since last timers tick
+  uint8_t event;                        ///< Event, one of #SFTM_TraceEvent_T
+  uint8_t timerIdx;                     ///< Index of timer or #SFTM_TRACE_NO_TIMER
+};
+
+/** @struct SFTM_TraceBuffer_T
+ *          Trace buffer. Whole structure is dumped as it is and decoded on host.
+ */
+struct SFTM_TraceBuffer_Tag
+{
+  uint32_t magic;                       ///< #SFTM_TRACE_MAGIC
+  uint16_t version;                     ///< #SFTM_TRACE_VERSION
+  uint16_t recordsNumber;               ///< Capacity of records array
+  uint32_t timersClk;                   ///< Timers Clock in Hz
+  uint32_t subTicksPerTick;             ///< System tick ISR calls per timers tick
+  volatile uint32_t head;               ///< Number of records written since initialization
+  SFTM_TraceRecord_T records[SFTM_TRACE_BUFFER_SIZE]; ///< Records ring
+};
+
+#if (SFTM_CFG_TRACE)
+
+/*======================================================================================*/
+/*                   ####### EXPORTED FUNCTIONS PROTOTYPES #######                      */
+/*======================================================================================*/
+/**
+ * @brief Function for trace initialization.
+ *
+ *        This function clears trace buffer and fills its header. It is called by SFTM_Init,
+ *        application calls it only to clear trace later.
+ *
+ * @return void
+ */
+void SFTM_TraceInit(void);
+
+
+/**
+ * @brief Function for recording trace event.
+ *
+ *        This function can be called from any context including System tick ISR.
+ *        Oldest records are overwritten when buffer is full.
+ *
+ * @param [in] event to record.
+ * @param [in] timerIdx of timer related to event.
+ * @param [in] tick is timers tick of event.
+ * @param [in] subTick is System tick ISR calls since last timers tick.
+ *
+ * @return void
+ */
+void SFTM_TraceRecord(SFTM_TraceEvent_T event, uint8_t timerIdx, uint32_t tick, uint16_t subTick);
+
+
+/**
+ * @brief Function for getting trace buffer.
+ *
+ *        Dump sizeof(SFTM_TraceBuffer_T) bytes from returned address to decode trace on host.
+ *
+ * @return pointer to trace buffer.
+ */
+const SFTM_TraceBuffer_T* SFTM_TraceGetBuffer(void);
+
+#endif /* SFTM_CFG_TRACE */
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* SOFTTIMERSTRACE_H_ */
@@ -0,0 +1,140 @@
+/*=======================================================================================*
+ * @file    SoftTimersPort.c
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains Cortex-M port of Soft Timers module.
+ *======================================================================================*/
+
+/**
+ * @addtogroup SFTM Soft Timers Timers
+ * @{
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+#include <stddef.h>
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "SoftTimers.h"
+#include "SoftTimersPort.h"
+
+/*======================================================================================*/
+/*                  ####### EXPORTED FUNCTIONS DEFINITIONS #######                      */
+/*======================================================================================*/
+void SFTM_PortInit(void)
+{
+#if (SFTM_PORT_HAS_CYCLE_COUNTER)
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+void SFTM_PortStartTick(void)
+{
+  SysTick_Config(SystemCoreClock / SYSTEM_TICK_ISR_CLK);
+  NVIC_SetPriority(SysTick_IRQn, SFTM_PORT_TICK_PRIORITY);
+}
+
+void SFTM_PortFault(void)
+{
+  void (*Fault)(void) = NULL;
+  Fault();
+}
+
+uint32_t SFTM_PortSleep(uint32_t ticks)
+{
+  uint32_t cyclesPerTick = SystemCoreClock / TIMERS_CLK;
+  uint32_t cyclesPerPeriod = SystemCoreClock / SYSTEM_TICK_ISR_CLK;
+  uint32_t maxTicks = SysTick_LOAD_RELOAD_Msk / cyclesPerTick;
+  uint32_t sleptTicks;
+  uint32_t elapsedCycles;
+  uint32_t elapsedPeriods;
+  uint32_t primask = __get_PRIMASK();
+
+  if (ticks > maxTicks)
+  {
+    ticks = maxTicks;
+  }
+  else { /* Do nothing */ }
+
+  /* Masked interrupts must still wake core from WFI, PRIMASK does not block wakeup */
+  __disable_irq();
+#if (SFTM_PORT_USE_BASEPRI)
+  uint32_t basepri = __get_BASEPRI();
+  __set_BASEPRI(0);
+#endif
+
+  SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+  SysTick->LOAD = ticks * cyclesPerTick - 1;
+  SysTick->VAL = 0;
+  SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+  __DSB();
+  __WFI();
+  __ISB();
+
+  /* Reading CTRL clears COUNTFLAG, so read it only once */
+  uint32_t ctrl = SysTick->CTRL;
+  SysTick->CTRL = ctrl & ~SysTick_CTRL_ENABLE_Msk;
+
+  if (ctrl & SysTick_CTRL_COUNTFLAG_Msk)
+  {
+    elapsedCycles = SysTick->LOAD + 1;
+  }
+  else
+  {
+    elapsedCycles = SysTick->LOAD - SysTick->VAL;
+  }
+
+  /* Part of tick elapsed before early wakeup is split into whole System tick ISR periods and rest of period */
+  sleptTicks = elapsedCycles / cyclesPerTick;
+  elapsedCycles -= sleptTicks * cyclesPerTick;
+  elapsedPeriods = elapsedCycles / cyclesPerPeriod;
+  elapsedCycles -= elapsedPeriods * cyclesPerPeriod;
+  if (cyclesPerPeriod - elapsedCycles < 2)
+  {
+    /* SysTick cannot be reloaded with 0, almost whole period counts as whole */
+    elapsedPeriods++;
+    elapsedCycles = 0;
+  }
+  else { /* Do nothing */ }
+
+  /* Sleep period is credited at once, drop its pending SysTick. First SysTick comes after rest of current period,
+     counter takes period reload value on that wrap. */
+  SCB->ICSR = SCB_ICSR_PENDSTCLR_Msk;
+  SysTick->LOAD = cyclesPerPeriod - elapsedCycles - 1;
+  SysTick->VAL = 0;
+  SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+  SysTick->LOAD = cyclesPerPeriod - 1;
+
+  /* Tick is still masked by caller, so whole periods are counted like System tick ISR calls */
+  while (elapsedPeriods != 0)
+  {
+    SFTM_TimersHandler();
+    elapsedPeriods--;
+  }
+
+#if (SFTM_PORT_USE_BASEPRI)
+  __set_BASEPRI(basepri);
+#endif
+  __set_PRIMASK(primask);
+
+  return sleptTicks;
+}
+
+__attribute__((weak)) void SFTM_PortStartCompare(uint64_t delayNs)
+{
+  (void)delayNs;
+}
+
+__attribute__((weak)) void SysTick_Handler(void)
+{
+  SFTM_TimersHandler();
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,295 @@
+/*=======================================================================================*
+ * @file    SoftTimersPort.h
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   Header file for Soft Timers Cortex-M port
+ *
+ *          This file contains port layer of Soft Timers module for Cortex-M cores. It
+ *          provides time source, critical section, atomics, ISR notification and fault
+ *          hook. Critical section masks with BASEPRI only interrupts up to System tick
+ *          priority, interrupts of higher priority are not delayed. Cores without BASEPRI
+ *          use PRIMASK. DWT cycle counter is time source on cores which have it.
+ *======================================================================================*/
+/*----------------------- DEFINE TO PREVENT RECURSIVE INCLUSION ------------------------*/
+#ifndef SOFTTIMERSPORT_H_
+#define SOFTTIMERSPORT_H_
+
+/**
+ * @addtogroup SFTM Soft Timers Timers
+ * @{
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "cmsis_device.h"
+#include "SoftTimersConfig.h"
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+  #define SFTM_PORT_HAS_CYCLE_COUNTER 1          ///< DWT cycle counter is available
+#else
+  #define SFTM_PORT_HAS_CYCLE_COUNTER 0          ///< DWT cycle counter is not available
+#endif
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+  #define SFTM_PORT_HAS_BASEPRI       1          ///< BASEPRI register is available
+#else
+  #define SFTM_PORT_HAS_BASEPRI       0          ///< BASEPRI register is not available
+#endif
+
+/** @name Cortex-M port configuration.
+ */
+/**@{*/
+#ifndef SFTM_PORT_TICK_PRIORITY
+#define SFTM_PORT_TICK_PRIORITY       ((1UL << __NVIC_PRIO_BITS) - 1)  ///< SysTick priority, lowest by default
+#endif
+#ifndef SFTM_PORT_USE_BASEPRI
+#define SFTM_PORT_USE_BASEPRI         SFTM_PORT_HAS_BASEPRI            ///< Mask only up to tick priority
+#endif
+/**@}*/
+
+#if (SFTM_PORT_USE_BASEPRI) && !(SFTM_PORT_HAS_BASEPRI)
+  #error "BASEPRI is not available on this core! Please disable SFTM_PORT_USE_BASEPRI."
+#endif
+#if (SFTM_PORT_USE_BASEPRI) && (0 == SFTM_PORT_TICK_PRIORITY)
+  #error "Priority 0 cannot be masked with BASEPRI! Please lower SFTM_PORT_TICK_PRIORITY."
+#endif
+
+#define SFTM_PORT_BASEPRI_MASK        (SFTM_PORT_TICK_PRIORITY << (8 - __NVIC_PRIO_BITS))  ///< BASEPRI value masking tick
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+/** Critical section blocking System tick ISR, can be nested. */
+#if (SFTM_PORT_USE_BASEPRI)
+  #define SFTM_PORT_ENTER_CRITICAL()  uint32_t portCriticalState = __get_BASEPRI(); __set_BASEPRI_MAX(SFTM_PORT_BASEPRI_MASK)
+  #define SFTM_PORT_EXIT_CRITICAL()   __set_BASEPRI(portCriticalState)
+#else
+  #define SFTM_PORT_ENTER_CRITICAL()  uint32_t portCriticalState = __get_PRIMASK(); __disable_irq()
+  #define SFTM_PORT_EXIT_CRITICAL()   __set_PRIMASK(portCriticalState)
+#endif
+
+/** Atomic fetch and add of 32-bit value, safe against preemption by System tick ISR. */
+#define SFTM_PORT_ATOMIC_FETCH_ADD(pValue, value)   SFTM_PortAtomicFetchAdd((pValue), (value))
+
+/** Atomic compare and exchange of 32-bit value, pExpected gets current value on failure. */
+#define SFTM_PORT_ATOMIC_COMPARE_EXCHANGE(pValue, pExpected, desired)  \
+  SFTM_PortAtomicCompareExchange((pValue), (pExpected), (desired))
+
+/** Load of 32-bit value ordered before following accesses and store ordered after preceding ones. */
+#define SFTM_PORT_LOAD_ACQUIRE(pValue)              __atomic_load_n((pValue), __ATOMIC_ACQUIRE)
+#define SFTM_PORT_STORE_RELEASE(pValue, value)      __atomic_store_n((pValue), (value), __ATOMIC_RELEASE)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*======================================================================================*/
+/*                   ####### EXPORTED FUNCTIONS PROTOTYPES #######                      */
+/*======================================================================================*/
+/**
+ * @brief Function for port initialization.
+ *
+ *        This function enables DWT cycle counter if core has it.
+ *
+ * @return void
+ */
+void SFTM_PortInit(void);
+
+
+/**
+ * @brief Function for starting time source.
+ *
+ *        This function configures SysTick to fire with SYSTEM_TICK_ISR_CLK frequency and sets
+ *        its priority to SFTM_PORT_TICK_PRIORITY. Weak SysTick_Handler calling
+ *        #SFTM_TimersHandler is provided by the port.
+ *
+ * @return void
+ */
+void SFTM_PortStartTick(void);
+
+
+/**
+ * @brief Function for fault hook.
+ *
+ *        This function is called on unrecoverable usage error, it makes hard fault.
+ *
+ * @return void
+ */
+void SFTM_PortFault(void);
+
+
+/**
+ * @brief Function for sleeping with suppressed tick.
+ *
+ *        This function is called from #SFTM_IdleSleep within critical section. It reloads
+ *        SysTick with whole sleep period, at most its 24-bit range, and sleeps with WFI until
+ *        SysTick or any other interrupt wakes the core. Periodic SysTick is restored on exit.
+ *        After early wakeup System tick ISR periods of partially elapsed tick are counted by
+ *        #SFTM_TimersHandler calls and first SysTick comes after rest of current period, so
+ *        no time is lost.
+ *
+ * @param [in] ticks to sleep at most, in timers ticks.
+ *
+ * @return number of fully elapsed timers ticks.
+ */
+uint32_t SFTM_PortSleep(uint32_t ticks);
+
+
+/**
+ * @brief Function for arming one-shot compare of high resolution timers.
+ *
+ *        This function is called within critical section when the earliest high resolution
+ *        deadline changes. Default weak definition does nothing, so high resolution timers
+ *        expire in System tick ISR. Application overrides it to arm compare of spare
+ *        hardware timer whose ISR, at System tick priority, calls #SFTM_HiResCompareHandler.
+ *
+ * @param [in] delayNs until compare, 0 if deadline is already due.
+ *
+ * @return void
+ */
+void SFTM_PortStartCompare(uint64_t delayNs);
+
+
+/**
+ * @brief Function for getting timestamp.
+ *
+ * @return DWT cycle counter or 0 if core does not have it.
+ */
+static inline uint32_t SFTM_PortGetCycles(void)
+{
+#if (SFTM_PORT_HAS_CYCLE_COUNTER)
+  return DWT->CYCCNT;
+#else
+  return 0;
+#endif
+}
+
+
+/**
+ * @brief Function for getting time elapsed in current System tick ISR period.
+ *
+ *        This function reads SysTick counter, it is called within critical section, so
+ *        SysTick which wrapped meanwhile is pending and its period is added.
+ *
+ * @return time since last System tick ISR period start in ns.
+ */
+static inline uint32_t SFTM_PortGetSubTickNs(void)
+{
+  uint32_t reload = SysTick->LOAD;
+  uint32_t value = SysTick->VAL;
+  uint32_t cycles;
+
+  if (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)
+  {
+    /* Counter read before pending flag could be from before the wrap */
+    value = SysTick->VAL;
+    cycles = (reload + 1) + (reload - value);
+  }
+  else
+  {
+    cycles = reload - value;
+  }
+
+  return (uint32_t)((uint64_t)cycles * 1000000000ULL / SystemCoreClock);
+}
+
+
+/**
+ * @brief Function for notifying main loop about expired timers.
+ *
+ *        This function is called from System tick ISR, it sets event register.
+ *
+ * @return void
+ */
+static inline void SFTM_PortNotifyEvents(void)
+{
+  __SEV();
+}
+
+
+/**
+ * @brief Function for waiting for expired timers.
+ *
+ *        This function sleeps until event or interrupt occurs, it may return spuriously.
+ *
+ * @return void
+ */
+static inline void SFTM_PortWaitEvents(void)
+{
+  __WFE();
+}
+
+
+/**
+ * @brief Function for atomic fetch and add.
+ *
+ * @param [in] pValue to modify.
+ * @param [in] value to add.
+ *
+ * @return value before addition.
+ */
+static inline uint32_t SFTM_PortAtomicFetchAdd(volatile uint32_t *pValue, uint32_t value)
+{
+#if defined(__ARM_ARCH_6M__)
+  /* No exclusive access instructions on ARMv6-M */
+  SFTM_PORT_ENTER_CRITICAL();
+  uint32_t previous = *pValue;
+  *pValue = previous + value;
+  SFTM_PORT_EXIT_CRITICAL();
+
+  return previous;
+#else
+  /* LDREX/STREX loop, no interrupt is masked */
+  return __atomic_fetch_add(pValue, value, __ATOMIC_RELAXED);
+#endif
+}
+
+
+/**
+ * @brief Function for atomic compare and exchange.
+ *
+ * @param [in] pValue to modify.
+ * @param [in,out] pExpected value, current value is written back on failure.
+ * @param [in] desired value stored if pValue equals expected one.
+ *
+ * @return true if value was exchanged.
+ */
+static inline bool SFTM_PortAtomicCompareExchange(volatile uint32_t *pValue, uint32_t *pExpected, uint32_t desired)
+{
+#if defined(__ARM_ARCH_6M__)
+  /* No exclusive access instructions on ARMv6-M, mask all interrupts as producers may be above tick */
+  uint32_t primask = __get_PRIMASK();
+  bool exchanged;
+
+  __disable_irq();
+  exchanged = (*pValue == *pExpected);
+  if (exchanged)
+  {
+    *pValue = desired;
+  }
+  else
+  {
+    *pExpected = *pValue;
+  }
+  __set_PRIMASK(primask);
+
+  return exchanged;
+#else
+  return __atomic_compare_exchange_n(pValue, pExpected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* SOFTTIMERSPORT_H_ */
@@ -0,0 +1,273 @@
+/*=======================================================================================*
+ * @file    SoftTimersPort.c
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains POSIX port of Soft Timers module.
+ *======================================================================================*/
+
+/**
+ * @addtogroup SFTM Soft Timers Timers
+ * @{
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+#ifndef _XOPEN_SOURCE
+  #define _XOPEN_SOURCE 700
+#endif
+#include <errno.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "SoftTimers.h"
+#include "SoftTimersHiRes.h"
+#include "SoftTimersPort.h"
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+#define NS_PER_SECOND                 1000000000ULL                        ///< Nanoseconds in second
+#define TICK_PERIOD_NS                (NS_PER_SECOND / SYSTEM_TICK_ISR_CLK) ///< System tick ISR period
+#define TIMERS_TICK_NS                (NS_PER_SECOND / TIMERS_CLK)         ///< Timers tick period
+#define NO_COMPARE                    UINT64_MAX                           ///< Compare time when compare is not armed
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*-------------------------------- LOCAL OBJECTS ---------------------------------------*/
+static pthread_once_t PortOnce = PTHREAD_ONCE_INIT;  ///< Guards creation of port objects
+static pthread_mutex_t CriticalMutex;           ///< Recursive lock of critical section
+static pthread_mutex_t WakeupMutex;             ///< Guards tick thread wakeup condition
+static pthread_cond_t WakeupCondition;          ///< Signalled to stop tick thread or to arm compare
+static pthread_t TickThread;                    ///< Thread emulating System tick ISR
+static volatile bool TickStarted = false;       ///< Tick thread is running
+static uint64_t LastTickTime = 0;               ///< Monotonic time of last emulated ISR call
+static uint64_t CompareTime = NO_COMPARE;       ///< Monotonic time of armed compare, guarded by wakeup mutex
+static sem_t EventsSemaphore;                   ///< Posted when timers expire
+static bool EventsSemaphoreReady = false;       ///< Events semaphore is initialized
+
+/*======================================================================================*/
+/*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
+/*======================================================================================*/
+static void CreatePortObjects(void);
+static uint64_t GetMonotonicTime(void);
+static struct timespec ToTimespec(uint64_t time);
+static void* TickThreadFunction(void *pArgument);
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+static void CreatePortObjects(void)
+{
+  pthread_mutexattr_t mutexAttributes;
+  pthread_condattr_t conditionAttributes;
+
+  pthread_mutexattr_init(&mutexAttributes);
+  pthread_mutexattr_settype(&mutexAttributes, PTHREAD_MUTEX_RECURSIVE);
+  pthread_mutex_init(&CriticalMutex, &mutexAttributes);
+  pthread_mutexattr_destroy(&mutexAttributes);
+
+  pthread_mutex_init(&WakeupMutex, NULL);
+  pthread_condattr_init(&conditionAttributes);
+  pthread_condattr_setclock(&conditionAttributes, CLOCK_MONOTONIC);
+  pthread_cond_init(&WakeupCondition, &conditionAttributes);
+  pthread_condattr_destroy(&conditionAttributes);
+
+  EventsSemaphoreReady = (0 == sem_init(&EventsSemaphore, 0, 0));
+}
+
+static uint64_t GetMonotonicTime(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+
+  return (uint64_t)now.tv_sec * NS_PER_SECOND + (uint64_t)now.tv_nsec;
+}
+
+static struct timespec ToTimespec(uint64_t time)
+{
+  struct timespec result;
+
+  result.tv_sec  = (time_t)(time / NS_PER_SECOND);
+  result.tv_nsec = (long)(time % NS_PER_SECOND);
+
+  return result;
+}
+
+static void* TickThreadFunction(void *pArgument)
+{
+  uint64_t tickWakeupTime = GetMonotonicTime() + TIMERS_TICK_NS;
+  uint64_t now;
+  bool compareDue;
+  struct timespec wakeup;
+
+  (void)pArgument;
+
+  pthread_mutex_lock(&WakeupMutex);
+  while (TickStarted)
+  {
+    /* Wait returns early when compare is armed or tick is stopped */
+    wakeup = ToTimespec((CompareTime < tickWakeupTime) ? CompareTime : tickWakeupTime);
+    pthread_cond_timedwait(&WakeupCondition, &WakeupMutex, &wakeup);
+    compareDue = (CompareTime <= GetMonotonicTime());
+    if (compareDue)
+    {
+      CompareTime = NO_COMPARE;
+    }
+    else { /* Do nothing */ }
+    pthread_mutex_unlock(&WakeupMutex);
+
+    /* Catch up with every System tick ISR period elapsed since previous wakeup */
+    pthread_mutex_lock(&CriticalMutex);
+    now = GetMonotonicTime();
+    while (now - LastTickTime >= TICK_PERIOD_NS)
+    {
+      LastTickTime += TICK_PERIOD_NS;
+      SFTM_TimersHandler();
+    }
+#if (SFTM_CFG_HIRES)
+    if (compareDue)
+    {
+      SFTM_HiResCompareHandler();
+    }
+    else { /* Do nothing */ }
+#endif
+    pthread_mutex_unlock(&CriticalMutex);
+
+    if (now >= tickWakeupTime)
+    {
+      /* Thread preempted for long does not burst wakeups */
+      tickWakeupTime = (now - tickWakeupTime >= TIMERS_TICK_NS) ? now + TIMERS_TICK_NS : tickWakeupTime + TIMERS_TICK_NS;
+    }
+    else { /* Do nothing */ }
+    pthread_mutex_lock(&WakeupMutex);
+  }
+  pthread_mutex_unlock(&WakeupMutex);
+
+  return NULL;
+}
+
+/*======================================================================================*/
+/*                  ####### EXPORTED FUNCTIONS DEFINITIONS #######                      */
+/*======================================================================================*/
+void SFTM_PortInit(void)
+{
+  pthread_once(&PortOnce, CreatePortObjects);
+}
+
+void SFTM_PortStartTick(void)
+{
+  pthread_once(&PortOnce, CreatePortObjects);
+
+  pthread_mutex_lock(&CriticalMutex);
+  LastTickTime = GetMonotonicTime();
+  pthread_mutex_unlock(&CriticalMutex);
+
+  TickStarted = true;
+  if (0 != pthread_create(&TickThread, NULL, TickThreadFunction, NULL))
+  {
+    TickStarted = false;
+  }
+  else { /* Do nothing */ }
+}
+
+void SFTM_PortStopTick(void)
+{
+  if (TickStarted)
+  {
+    pthread_mutex_lock(&WakeupMutex);
+    TickStarted = false;
+    pthread_cond_signal(&WakeupCondition);
+    pthread_mutex_unlock(&WakeupMutex);
+    pthread_join(TickThread, NULL);
+  }
+  else { /* Do nothing */ }
+}
+
+void SFTM_PortFault(void)
+{
+  abort();
+}
+
+uint32_t SFTM_PortSleep(uint32_t ticks)
+{
+  uint64_t startTime = GetMonotonicTime();
+  uint64_t sleptTicks;
+  struct timespec wakeup = ToTimespec(startTime + (uint64_t)ticks * TIMERS_TICK_NS);
+
+  /* Tick thread waits on critical section meanwhile, any signal wakes up early like interrupt does */
+  clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeup, NULL);
+
+  sleptTicks = (GetMonotonicTime() - startTime) / TIMERS_TICK_NS;
+  if (sleptTicks > ticks)
+  {
+    sleptTicks = ticks;
+  }
+  else { /* Do nothing */ }
+
+  /* Credited periods must not be caught up again by tick thread */
+  LastTickTime += sleptTicks * TIMERS_TICK_NS;
+
+  return (uint32_t)sleptTicks;
+}
+
+void SFTM_PortStartCompare(uint64_t delayNs)
+{
+  pthread_mutex_lock(&WakeupMutex);
+  CompareTime = GetMonotonicTime() + delayNs;
+  pthread_cond_signal(&WakeupCondition);
+  pthread_mutex_unlock(&WakeupMutex);
+}
+
+uint32_t SFTM_PortGetCycles(void)
+{
+  return (uint32_t)GetMonotonicTime();
+}
+
+uint32_t SFTM_PortGetSubTickNs(void)
+{
+  /* Without tick thread engine time is moved by SFTM_Advance only */
+  return TickStarted ? (uint32_t)(GetMonotonicTime() - LastTickTime) : 0;
+}
+
+void SFTM_PortNotifyEvents(void)
+{
+  if (EventsSemaphoreReady)
+  {
+    sem_post(&EventsSemaphore);
+  }
+  else { /* Do nothing */ }
+}
+
+void SFTM_PortWaitEvents(void)
+{
+  while (0 != sem_wait(&EventsSemaphore) && EINTR == errno)
+  {
+    /* Interrupted by signal, wait again */
+  }
+}
+
+uint32_t SFTM_PortEnterCritical(void)
+{
+  pthread_once(&PortOnce, CreatePortObjects);
+  pthread_mutex_lock(&CriticalMutex);
+
+  return 0;
+}
+
+void SFTM_PortExitCritical(uint32_t state)
+{
+  (void)state;
+  pthread_mutex_unlock(&CriticalMutex);
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,198 @@
+/*=======================================================================================*
+ * @file    SoftTimersPort.h
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   Header file for Soft Timers POSIX port
+ *
+ *          This file contains port layer of Soft Timers module for POSIX hosts. System
+ *          tick ISR is emulated with dedicated tick thread, critical section is recursive
+ *          mutex held by that thread for whole emulated ISR. Functions which start, stop,
+ *          pause, delete or read timers and groups, and posted commands, can be called from
+ *          any thread, they change timers only within critical section. #SFTM_CreateTimer,
+ *          #SFTM_CreateGroup, #SFTM_RegisterBatchCallback and event queue setup are not
+ *          locked and have to be called from one thread. #SFTM_TimersEventsHandler must
+ *          run in one thread only and #SFTM_PortStartTick / #SFTM_PortStopTick must not be
+ *          called within critical section or from timer callbacks. Port is intended for
+ *          native builds, tests, profiling and benchmarks.
+ *======================================================================================*/
+/*----------------------- DEFINE TO PREVENT RECURSIVE INCLUSION ------------------------*/
+#ifndef SOFTTIMERSPORT_H_
+#define SOFTTIMERSPORT_H_
+
+/**
+ * @addtogroup SFTM Soft Timers Timers
+ * @{
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+#include <stdint.h>
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "SoftTimersConfig.h"
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+/** Critical section excluding tick thread in all threads of process, can be nested. */
+#define SFTM_PORT_ENTER_CRITICAL()    uint32_t portCriticalState = SFTM_PortEnterCritical()
+#define SFTM_PORT_EXIT_CRITICAL()     SFTM_PortExitCritical(portCriticalState)
+
+/** Atomic fetch and add of 32-bit value, safe against concurrent threads. */
+#define SFTM_PORT_ATOMIC_FETCH_ADD(pValue, value)   __atomic_fetch_add((pValue), (value), __ATOMIC_RELAXED)
+
+/** Atomic compare and exchange of 32-bit value, pExpected gets current value on failure. */
+#define SFTM_PORT_ATOMIC_COMPARE_EXCHANGE(pValue, pExpected, desired)  \
+  __atomic_compare_exchange_n((pValue), (pExpected), (desired), false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)
+
+/** Load of 32-bit value ordered before following accesses and store ordered after preceding ones. */
+#define SFTM_PORT_LOAD_ACQUIRE(pValue)              __atomic_load_n((pValue), __ATOMIC_ACQUIRE)
+#define SFTM_PORT_STORE_RELEASE(pValue, value)      __atomic_store_n((pValue), (value), __ATOMIC_RELEASE)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*======================================================================================*/
+/*                   ####### EXPORTED FUNCTIONS PROTOTYPES #######                      */
+/*======================================================================================*/
+/**
+ * @brief Function for port initialization.
+ *
+ *        This function creates critical section mutex and events semaphore once.
+ *
+ * @return void
+ */
+void SFTM_PortInit(void);
+
+
+/**
+ * @brief Function for starting time source.
+ *
+ *        This function starts tick thread which wakes up with TIMERS_CLK frequency or on
+ *        compare time and, holding critical section, calls #SFTM_TimersHandler once per every System tick ISR
+ *        period elapsed on monotonic clock, so SYSTEM_TICK_ISR_CLK may exceed wakeup rate.
+ *
+ * @return void
+ */
+void SFTM_PortStartTick(void);
+
+
+/**
+ * @brief Function for stopping time source.
+ *
+ *        This function joins tick thread, call it outside of critical section.
+ *
+ * @return void
+ */
+void SFTM_PortStopTick(void);
+
+
+/**
+ * @brief Function for fault hook.
+ *
+ *        This function is called on unrecoverable usage error, it aborts the process.
+ *
+ * @return void
+ */
+void SFTM_PortFault(void);
+
+
+/**
+ * @brief Function for sleeping with suppressed tick.
+ *
+ *        This function is called from #SFTM_IdleSleep within critical section, so tick
+ *        thread is held off while it sleeps with clock_nanosleep until given time elapses
+ *        or any signal interrupts it. Credited ticks are skipped by tick thread, part of
+ *        tick elapsed before early wakeup is caught up by tick thread after exit.
+ *
+ * @param [in] ticks to sleep at most, in timers ticks.
+ *
+ * @return number of fully elapsed timers ticks.
+ */
+uint32_t SFTM_PortSleep(uint32_t ticks);
+
+
+/**
+ * @brief Function for arming one-shot compare of high resolution timers.
+ *
+ *        This function is called within critical section when the earliest high resolution
+ *        deadline changes. It sets wakeup time of tick thread, which calls
+ *        #SFTM_HiResCompareHandler on that time. It has no effect until tick is started.
+ *
+ * @param [in] delayNs until compare, 0 if deadline is already due.
+ *
+ * @return void
+ */
+void SFTM_PortStartCompare(uint64_t delayNs);
+
+
+/**
+ * @brief Function for getting timestamp.
+ *
+ * @return monotonic clock in ns, truncated to 32 bits.
+ */
+uint32_t SFTM_PortGetCycles(void);
+
+
+/**
+ * @brief Function for getting time elapsed in current System tick ISR period.
+ *
+ *        This function is called within critical section, so it includes periods which
+ *        tick thread has not caught up with yet.
+ *
+ * @return monotonic time since last emulated System tick ISR call in ns or 0 if tick is
+ *         not started.
+ */
+uint32_t SFTM_PortGetSubTickNs(void);
+
+
+/**
+ * @brief Function for notifying main loop about expired timers.
+ *
+ *        This function posts events semaphore.
+ *
+ * @return void
+ */
+void SFTM_PortNotifyEvents(void);
+
+
+/**
+ * @brief Function for waiting for expired timers.
+ *
+ *        This function blocks on events semaphore, it may return spuriously. Do not call it
+ *        before tick is started.
+ *
+ * @return void
+ */
+void SFTM_PortWaitEvents(void);
+
+
+/**
+ * @brief Function for entering critical section.
+ *
+ * @return state to pass to #SFTM_PortExitCritical.
+ */
+uint32_t SFTM_PortEnterCritical(void);
+
+
+/**
+ * @brief Function for exiting critical section.
+ *
+ * @param [in] state returned by #SFTM_PortEnterCritical.
+ *
+ * @return void
+ */
+void SFTM_PortExitCritical(uint32_t state);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* SOFTTIMERSPORT_H_ */
@@ -15,38 +15,191 @@
 /*                       ####### PREPROCESSOR DIRECTIVES #######                        */
 /*======================================================================================*/
 /*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+#include <string.h>
 
 /*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
 #include "SoftTimers.h"
+#include "SoftTimersHiRes.h"
+#include "SoftTimersPort.h"
+#include "SoftTimersStats.h"
+#include "SoftTimersTrace.h"
 
 /*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
-/** @name Timers module configuration.
- *        Configure System Tick ISR Clock, Timers Clock and some other things.
- */
-/**@{*/
-#define SYSTEM_TICK_ISR_CLK           1000000    ///< System Tick ISR Clock in Hz
-#define TIMERS_CLK                    1000       ///< Timers Clock in Hz
-#define MAX_TIMER_SLOTS               8          ///< Adjust this value according to your needs
-/**@}*/
-
 #define TICK_CMP                      SYSTEM_TICK_ISR_CLK / TIMERS_CLK    ///< Comparison value for timers handler
-#define TIMIER_IDLE_VALUE             0xFFFFFFFF                          ///< Initial timer value
+#define TIMIER_IDLE_VALUE             0xFFFFFFFF                          ///< Timer tick of idle timer
 #define MAX_TIMERS_NUMBER_REACHED     0xFF                                ///< Maximum number of timers in system
+#define NOT_IN_HEAP                   0xFF                                ///< Heap index of timer which is not running
+#define NO_TIMER                      0xFF                                ///< Timer index terminating parked timers list
+#define NO_GROUP                      0xFF                                ///< Group index of timer which is not in group
+#define EXPIRED_QUEUE_SIZE            (MAX_TIMER_SLOTS + 1)               ///< Expired timers queue size, one slot is always empty
+#define FAR_TIMEOUT                   0x40000000                          ///< Timeouts from this value wait in far future tier
+#define FAR_SCAN_PERIOD               0x100000                            ///< Ticks between far future tier scans, power of 2
+#define SNAPSHOT_MAGIC                0x53                                ///< First byte of timers snapshot
+#define SNAPSHOT_HEADER_SIZE          SFTM_SNAPSHOT_SIZE(0)               ///< Snapshot header size in bytes
+#define SNAPSHOT_RECORD_SIZE          (SFTM_SNAPSHOT_SIZE(1) - SNAPSHOT_HEADER_SIZE)  ///< Snapshot timer record size in bytes
+#define COMMAND_QUEUE_MASK            (SFTM_COMMAND_QUEUE_SIZE - 1)       ///< Command queue position to cell index mask
+#define NS_PER_US                     1000ULL                             ///< Nanoseconds in microsecond
+#define NS_PER_TIMERS_TICK            (1000000000ULL / TIMERS_CLK)        ///< Timers tick period in ns
+#define NS_PER_BASE_TICK              (1000000000ULL / SYSTEM_TICK_ISR_CLK) ///< System tick ISR period in ns
 
 #if (MAX_TIMER_SLOTS > MAX_TIMERS_NUMBER_REACHED )
   #error "Maximum timer slots reached! Please decrease timer slot number."
 #endif
 
+#if (SFTM_CFG_GROUPS) && (MAX_TIMER_GROUPS >= NO_GROUP)
+  #error "Maximum timer groups reached! Please decrease timer groups number."
+#endif
+
+#if (SFTM_CFG_COMMAND_QUEUE) && ((SFTM_COMMAND_QUEUE_SIZE & COMMAND_QUEUE_MASK) != 0)
+  #error "Command queue size has to be power of 2!"
+#endif
+
+#if (SFTM_CFG_COMPACT) && (MAX_COMPACT_CALLBACKS >= SFTM_NO_CALLBACK_ID)
+  #error "Maximum compact callbacks reached! Please decrease compact callbacks number."
+#endif
+
 /*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+#define IS_BEFORE(tickA, tickB)       ((int32_t)((tickA) - (tickB)) < 0)  ///< Wraparound safe ticks comparison
+#define GET_DEADLINE(timeout)         (TimersTick + ((timeout) != 0 ? (timeout) : 1))   ///< Deadline of timer started now
+#if (SFTM_CFG_GROUPS)
+  #define SYNC_GROUP_MEMBERSHIP(timerHandle)  \
+    do { SFTM_ENTER_CRITICAL(); SyncGroupMembership(SFTM_GetTimerIndex(timerHandle)); SFTM_EXIT_CRITICAL(); } while (0)
+  #define SYNC_GROUP(timerIdx)        SyncGroupMembership(timerIdx)   ///< Group sync within critical section
+#else
+  #define SYNC_GROUP_MEMBERSHIP(timerHandle)
+  #define SYNC_GROUP(timerIdx)
+#endif
+
+/** Dispatched timer changed by its own callback is not finished by events handler */
+#define NOTE_TIMER_CHANGE(timerIdx)   \
+  do { if ((timerIdx) == DispatchedTimer) { DispatchedTimerChanged = true; } else { /* Do nothing */ } } while (0)
+
+#if (SFTM_CFG_EVENT_QUEUE)
+  #define POST_EVENT(timerIdx, pContext)      PostEvent((timerIdx), (pContext))
+#else
+  #define POST_EVENT(timerIdx, pContext)      false
+#endif
+
+#if (SFTM_CFG_BATCH)
+  #define ADD_TO_BATCH(onExpire, pContext)    AddToBatch((onExpire), (pContext))
+#else
+  #define ADD_TO_BATCH(onExpire, pContext)    false
+#endif
+
+#if (SFTM_CFG_GROUPS)
+  #define STATIC_TIMER_GROUP_INIT     .group = NO_GROUP, .nextParked = NO_TIMER,
+#else
+  #define STATIC_TIMER_GROUP_INIT
+#endif
+
+/** Configuration of static timers list entry */
+#define STATIC_TIMER_CONFIG(name, type, tmo, callback, context)  \
+  { .timerType = (type), .timeout = (tmo), .onExpire = (callback), .pContext = (context) },
+
+/** Timer slot initializer of static timers list entry */
+#if (SFTM_CFG_ROM_DESCRIPTORS)
+  #define STATIC_TIMER_INIT(name, type, tmo, callback, context)  \
+    { .state = SFTM_TIMER_IDLE, .heapIdx = NOT_IN_HEAP, STATIC_TIMER_GROUP_INIT },
+#else
+  #define STATIC_TIMER_INIT(name, type, tmo, callback, context)  \
+    { .timerType = (type), .timeout = (tmo), .state = SFTM_TIMER_IDLE, .heapIdx = NOT_IN_HEAP, \
+      .onExpire = (callback), .pContext = (context), STATIC_TIMER_GROUP_INIT },
+#endif
+
+/** Timer configuration, static timers one is in ROM if descriptors are split */
+#if (SFTM_CFG_ROM_DESCRIPTORS)
+  #define GET_CONFIG(timerIdx)        (((timerIdx) < SFTM_STATIC_TIMERS_NUMBER) ? &StaticConfigsArray[timerIdx] : \
+                                       &TimerConfigsArray[(timerIdx) - SFTM_STATIC_TIMERS_NUMBER])
+  #define GET_WRITABLE_CONFIG(timerIdx)  (&TimerConfigsArray[(timerIdx) - SFTM_STATIC_TIMERS_NUMBER])
+  #define IS_CONFIG_WRITABLE(timerIdx)   ((timerIdx) >= SFTM_STATIC_TIMERS_NUMBER)
+#else
+  #define GET_CONFIG(timerIdx)        (&TimersArray[timerIdx])
+  #define GET_WRITABLE_CONFIG(timerIdx)  (&TimersArray[timerIdx])
+  #define IS_CONFIG_WRITABLE(timerIdx)   true
+#endif
+
+/** Timer deadline and callback, compact timer keeps low half of deadline and callbacks table index */
+#if (SFTM_CFG_COMPACT)
+  #define TIMER_DEADLINE(pTimer)      ((SFTM_ticks)(TimersTick + (SFTM_ticks)(int16_t)((pTimer)->deadline - (uint16_t)TimersTick)))
+  #define GET_ON_EXPIRE(timerIdx)     ((TimersArray[timerIdx].callbackId != SFTM_NO_CALLBACK_ID) ? \
+                                       CallbacksArray[TimersArray[timerIdx].callbackId].onExpire : NULL)
+  #define GET_CONTEXT(timerIdx)       ((TimersArray[timerIdx].callbackId != SFTM_NO_CALLBACK_ID) ? \
+                                       CallbacksArray[TimersArray[timerIdx].callbackId].pContext : NULL)
+#else
+  #define TIMER_DEADLINE(pTimer)      ((pTimer)->deadline)
+  #define GET_ON_EXPIRE(timerIdx)     (GET_CONFIG(timerIdx)->onExpire)
+  #define GET_CONTEXT(timerIdx)       (GET_CONFIG(timerIdx)->pContext)
+#endif
+
+#define MIN(a, b)                     (((a) < (b)) ? (a) : (b))
+#define MAX(a, b)                     (((a) > (b)) ? (a) : (b))
+#define GET_BASE_TIME()               ((uint32_t)(TimersTick * (TICK_CMP) + BaseTicks))   ///< Time in System tick ISR periods
+
+#if (SFTM_CFG_TRACE)
+  #define SFTM_TRACE(event, timerIdx)   SFTM_TraceRecord((event), (timerIdx), TimersTick, (uint16_t)BaseTicks)
+#else
+  #define SFTM_TRACE(event, timerIdx)
+#endif
+
+/** Critical section protecting running timers heap and expired timers queue against timers handler. */
+#ifndef SFTM_ENTER_CRITICAL
+  #define SFTM_ENTER_CRITICAL()       SFTM_PORT_ENTER_CRITICAL()
+  #define SFTM_EXIT_CRITICAL()        SFTM_PORT_EXIT_CRITICAL()
+#endif
 
 /*======================================================================================*/
 /*                      ####### LOCAL TYPE DECLARATIONS #######                         */
 /*======================================================================================*/
 /*-------------------------------- OTHER TYPEDEFS --------------------------------------*/
+#if (SFTM_CFG_ROM_DESCRIPTORS)
+typedef SFTM_TimerConfig_T TimerConfig_T;         ///< Timer configuration kept apart from timer
+#else
+typedef SFTM_Timer_T TimerConfig_T;               ///< Timer configuration kept in timer
+#endif
 
 /*------------------------------------- ENUMS ------------------------------------------*/
+#if (SFTM_CFG_COMMAND_QUEUE)
+/** @enum CommandCode_T
+ *        Posted timer command code.
+ */
+typedef enum CommandCode_Tag
+{
+  COMMAND_START = 0,                    ///< Start timer
+  COMMAND_STOP,                         ///< Stop timer
+  COMMAND_RESTART,                      ///< Restart timer
+} CommandCode_T;
+#endif
 
 /*------------------------------- STRUCT AND UNIONS ------------------------------------*/
+#if (SFTM_CFG_COMMAND_QUEUE)
+/** @struct Command_T
+ *          Command queue cell. Sequence equal to queue position of cell means cell is free,
+ *          position + 1 means command is published and waits for System tick ISR.
+ */
+typedef struct Command_Tag
+{
+  volatile uint32_t sequence;           ///< Cell state shared by producers and System tick ISR
+  uint8_t code;                         ///< Command code, one of #CommandCode_T
+  uint8_t timerIdx;                     ///< Index of commanded timer
+  uint8_t timerType;                    ///< Timer type of start command
+  SFTM_timeoutMS timeout;               ///< Timeout of start command
+  SFTM_TimerCallback_T onExpire;        ///< Callback of start command
+  void *pContext;                       ///< Context of start command
+} Command_T;
+#endif
+
+#if (SFTM_CFG_BATCH)
+/** @struct Batch_T
+ *          Batch callback with contexts of timers expired in current events handler call.
+ */
+typedef struct Batch_Tag
+{
+  SFTM_TimerCallback_T onExpire;        ///< Callback of batched timers
+  SFTM_BatchCallback_T onExpireBatch;   ///< Function called with all expired contexts
+  uint8_t contextsNumber;               ///< Number of collected contexts
+  void *pContexts[MAX_TIMER_SLOTS];     ///< Collected contexts in expiration order
+} Batch_T;
+#endif
 
 /*======================================================================================*/
 /*                         ####### OBJECT DEFINITIONS #######                           */
@@ -54,183 +207,1827 @@
 /*------------------------------- EXPORTED OBJECTS -------------------------------------*/
 
 /*-------------------------------- LOCAL OBJECTS ---------------------------------------*/
+#if (SFTM_CFG_STATIC_TIMERS)
+static const SFTM_TimerConfig_T StaticConfigsArray[SFTM_STATIC_TIMERS_NUMBER] = { SFTM_STATIC_TIMERS(STATIC_TIMER_CONFIG) }; ///< Declared static timers configuration
+static SFTM_Timer_T TimersArray[MAX_TIMER_SLOTS] = { SFTM_STATIC_TIMERS(STATIC_TIMER_INIT) }; ///< Timers array, static timers first, other slots are initialized on creation
+#else
 static SFTM_Timer_T TimersArray[MAX_TIMER_SLOTS]; ///< Timers array
-static uint8_t CurrentTimersNumber = 0;           ///< Variable for storing current number of timers in system
+#endif
+#if (SFTM_CFG_ROM_DESCRIPTORS) && (SFTM_DYNAMIC_TIMER_SLOTS > 0)
+static SFTM_TimerConfig_T TimerConfigsArray[SFTM_DYNAMIC_TIMER_SLOTS]; ///< Created timers configuration
+#endif
+static uint8_t CurrentTimersNumber = SFTM_STATIC_TIMERS_NUMBER; ///< Variable for storing current number of timers in system
+static volatile uint32_t BaseTicks = 0;           ///< System tick ISR calls since last timers tick
+static volatile SFTM_ticks TimersTick = 0;        ///< Timers ticks since start, wraps around
+static volatile uint32_t TimersEpoch = 0;         ///< Number of timers tick wraparounds
+static uint8_t TimersHeap[MAX_TIMER_SLOTS];       ///< Running timers indexes, min heap ordered by deadline
+static uint8_t TimersHeapSize = 0;                ///< Number of running timers
+static volatile uint8_t ExpiredQueue[EXPIRED_QUEUE_SIZE]; ///< Expired timers indexes in expiration order
+static volatile uint8_t ExpiredQueueHead = 0;     ///< Expired timers queue write position
+static volatile uint8_t ExpiredQueueTail = 0;     ///< Expired timers queue read position
+static uint8_t FarTimersNumber = 0;               ///< Running timers waiting in far future tier
+static volatile uint8_t DispatchedTimer = NO_TIMER;  ///< Timer whose callback is running, NO_TIMER outside of callback
+static volatile bool DispatchedTimerChanged = false; ///< Callback stopped or rescheduled its own timer
+#if (SFTM_CFG_GROUPS)
+static SFTM_TimerGroup_T GroupsArray[MAX_TIMER_GROUPS]; ///< Timer groups array
+static uint8_t CurrentGroupsNumber = 0;           ///< Current number of timer groups
+#endif
+#if (SFTM_CFG_BATCH)
+static Batch_T BatchesArray[MAX_BATCH_CALLBACKS]; ///< Batch callbacks array
+static uint8_t CurrentBatchesNumber = 0;          ///< Current number of batch callbacks
+#endif
+#if (SFTM_CFG_COMMAND_QUEUE)
+static Command_T CommandQueue[SFTM_COMMAND_QUEUE_SIZE]; ///< Posted timer commands
+static volatile uint32_t CommandQueueHead = 0;    ///< Command queue position claimed by next producer
+static uint32_t CommandQueueTail = 0;             ///< Command queue position applied next by System tick ISR
+#endif
+#if (SFTM_CFG_COMPACT)
+static SFTM_Callback_T CallbacksArray[MAX_COMPACT_CALLBACKS]; ///< Callbacks of compact timers
+static uint8_t CallbackReferences[MAX_COMPACT_CALLBACKS]; ///< Number of timers referring to callbacks table entry
+static uint8_t CurrentCallbacksNumber = 0;        ///< Number of callbacks table entries used since init
+#endif
 
 /*======================================================================================*/
 /*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
 /*======================================================================================*/
+static void HeapSwap(uint8_t heapPosA, uint8_t heapPosB);
+static void HeapSiftUp(uint8_t heapPos);
+static void HeapSiftDown(uint8_t heapPos);
+static void HeapInsert(uint8_t timerIdx);
+static void HeapRemove(uint8_t timerIdx);
+static void InsertTimer(uint8_t timerIdx);
+static void ScheduleTimer(uint8_t timerIdx, SFTM_ticks ticks);
+static void UnscheduleTimer(uint8_t timerIdx);
+static SFTM_ticks GetEffectiveDeadline(const SFTM_Timer_T *pTimer);
+#if (SFTM_CFG_SUBTICK)
+static uint64_t GetRemainingTimeNs(const SFTM_Timer_T *pTimer);
+#endif
+#if (SFTM_CFG_GROUPS)
+static void SyncGroupMembership(uint8_t timerIdx);
+static void UnparkTimer(uint8_t timerIdx);
+static bool ApplyGroup(uint8_t timerIdx);
+#endif
+static void MigrateFarTimers(void);
+static void ExpireDueTimers(void);
+static void MoveTimersTick(SFTM_ticks ticks);
+static uint64_t GetBaseTimeNs(void);
+#if (SFTM_CFG_HIRES)
+static SFTM_ticks GetHiResTicksToNextDeadline(void);
+#endif
+static SFTM_ticks GetTicksToNextExpiry(void);
+static bool PopExpiredTimer(uint8_t *pTimerIdx, SFTM_Callback_T *pCallback);
+static void ResetTimerSlot(uint8_t timerIdx);
+static void ClearConfig(TimerConfig_T *pConfig);
+static void SetCallback(TimerConfig_T *pConfig, SFTM_TimerCallback_T onExpire, void *pContext);
+#if (SFTM_CFG_COMPACT)
+static void ReleaseCallback(uint8_t callbackId);
+#endif
+#if (SFTM_CFG_STATIC_TIMERS) && !(SFTM_CFG_ROM_DESCRIPTORS)
+static void SetConfig(TimerConfig_T *pConfig, const SFTM_TimerConfig_T *pSource);
+#endif
+static void StartConfiguredTimer(uint8_t timerIdx);
+static SFTM_TimerRet_T StartTimer(uint8_t timerIdx, SFTM_TimerType_T timerType, SFTM_TimerCallback_T onExpire, void *pContext, SFTM_timeoutMS timeout);
+static void StopTimer(uint8_t timerIdx);
+static void RestartTimer(uint8_t timerIdx);
+#if (SFTM_CFG_EVENT_QUEUE)
+static bool PostEvent(uint8_t timerIdx, void *pContext);
+#endif
+#if (SFTM_CFG_BATCH)
+static void CallBatch(Batch_T *pBatch);
+static bool AddToBatch(SFTM_TimerCallback_T onExpire, void *pContext);
+#endif
+#if (SFTM_CFG_COMMAND_QUEUE)
+static bool PostCommand(const Command_T *pCommand);
+static void ApplyCommands(void);
+#endif
+#if (SFTM_CFG_SNAPSHOT)
+static void PutUint32(uint8_t *pBuffer, uint32_t value);
+static uint32_t GetUint32(const uint8_t *pBuffer);
+#endif
+#if (SFTM_CFG_SNAPSHOT) || (SFTM_CFG_COMPACT)
+static uint8_t FindCallbackId(SFTM_TimerCallback_T onExpire, void *pContext, const SFTM_Callback_T *pCallbacks, uint8_t callbacksNumber);
+#endif
 
 /*======================================================================================*/
 /*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
 /*======================================================================================*/
+static void HeapSwap(uint8_t heapPosA, uint8_t heapPosB)
+{
+  uint8_t timerIdx = TimersHeap[heapPosA];
 
-/*======================================================================================*/
-/*                  ####### EXPORTED FUNCTIONS DEFINITIONS #######                      */
-/*======================================================================================*/
-void SFTM_Init(void)
+  TimersHeap[heapPosA] = TimersHeap[heapPosB];
+  TimersHeap[heapPosB] = timerIdx;
+  TimersArray[TimersHeap[heapPosA]].heapIdx = heapPosA;
+  TimersArray[TimersHeap[heapPosB]].heapIdx = heapPosB;
+}
+
+static void HeapSiftUp(uint8_t heapPos)
 {
-  for (uint8_t timerCnt = 0; timerCnt < MAX_TIMER_SLOTS; timerCnt++)
+  while (heapPos > 0)
   {
-    TimersArray[timerCnt].ticks        = TIMIER_IDLE_VALUE;
-    TimersArray[timerCnt].timeout      = 0;
-    TimersArray[timerCnt].expiredFlag  = false;
-    TimersArray[timerCnt].onExpire     = NULL;
-    TimersArray[timerCnt].pContext     = NULL;
+    uint8_t parentPos = (uint8_t)((heapPos - 1) / 2);
+
+    if (IS_BEFORE(TIMER_DEADLINE(&TimersArray[TimersHeap[heapPos]]), TIMER_DEADLINE(&TimersArray[TimersHeap[parentPos]])))
+    {
+      HeapSwap(heapPos, parentPos);
+      heapPos = parentPos;
+    }
+    else
+    {
+      break;
+    }
   }
 }
 
-void SFTM_TimersHandler(void)
+static void HeapSiftDown(uint8_t heapPos)
 {
-  static volatile uint32_t ticks = 0;
+  while (true)
+  {
+    uint16_t childPos = 2 * (uint16_t)heapPos + 1;
+    uint8_t earliestPos = heapPos;
 
-  ticks++;
+    if (childPos < TimersHeapSize &&
+        IS_BEFORE(TIMER_DEADLINE(&TimersArray[TimersHeap[childPos]]), TIMER_DEADLINE(&TimersArray[TimersHeap[earliestPos]])))
+    {
+      earliestPos = (uint8_t)childPos;
+    }
+    else { /* Do nothing */ }
 
-  if (TICK_CMP == ticks)
-  {
-    /* Clear base ticks */
-    ticks = 0;
+    childPos++;
+    if (childPos < TimersHeapSize &&
+        IS_BEFORE(TIMER_DEADLINE(&TimersArray[TimersHeap[childPos]]), TIMER_DEADLINE(&TimersArray[TimersHeap[earliestPos]])))
+    {
+      earliestPos = (uint8_t)childPos;
+    }
+    else { /* Do nothing */ }
 
-    for (uint8_t timerCnt = 0; timerCnt < MAX_TIMER_SLOTS; timerCnt++)
+    if (earliestPos == heapPos)
     {
-      if (TimersArray[timerCnt].expiredFlag != true && TimersArray[timerCnt].ticks != TIMIER_IDLE_VALUE)
-      {
-        /* Increment timer ticks */
-        TimersArray[timerCnt].ticks++;
-
-        /* Check if expires */
-        if (TimersArray[timerCnt].ticks == TimersArray[timerCnt].timeout)
-        {
-          TimersArray[timerCnt].expiredFlag = true;
-        }
-        else
-        {
-          /* Do nothing */
-        }
-      }
-      else
-      {
-        /* Do nothing */
-      }
+      break;
     }
+    else
+    {
+      HeapSwap(heapPos, earliestPos);
+      heapPos = earliestPos;
+    }
+  }
+}
+
+static void HeapInsert(uint8_t timerIdx)
+{
+  uint8_t heapPos = TimersHeapSize++;
+
+  TimersHeap[heapPos] = timerIdx;
+  TimersArray[timerIdx].heapIdx = heapPos;
+  HeapSiftUp(heapPos);
+}
+
+static void HeapRemove(uint8_t timerIdx)
+{
+  uint8_t heapPos = TimersArray[timerIdx].heapIdx;
+  uint8_t lastPos = --TimersHeapSize;
+
+  TimersArray[timerIdx].heapIdx = NOT_IN_HEAP;
+
+  if (heapPos != lastPos)
+  {
+    /* Fill the gap with the last timer and restore heap order */
+    uint8_t movedIdx = TimersHeap[lastPos];
+
+    TimersHeap[heapPos] = movedIdx;
+    TimersArray[movedIdx].heapIdx = heapPos;
+    HeapSiftUp(heapPos);
+    HeapSiftDown(TimersArray[movedIdx].heapIdx);
+  }
+  else { /* Do nothing */ }
+}
+
+static void InsertTimer(uint8_t timerIdx)
+{
+  /* Deadlines in heap have to stay within half of ticks range for wraparound safe comparison */
+  if ((SFTM_ticks)(TIMER_DEADLINE(&TimersArray[timerIdx]) - TimersTick) < FAR_TIMEOUT)
+  {
+    HeapInsert(timerIdx);
   }
   else
   {
-    /* Do nothing */
+    FarTimersNumber++;
   }
 }
 
-SFTM_TimerHandle_T SFTM_CreateTimer(void)
+static void ScheduleTimer(uint8_t timerIdx, SFTM_ticks ticks)
 {
-  uint8_t newTimerNumber = 0;
+  SFTM_Timer_T *pTimer = &TimersArray[timerIdx];
 
-  if (CurrentTimersNumber < MAX_TIMER_SLOTS)
+  NOTE_TIMER_CHANGE(timerIdx);
+
+  pTimer->deadline = GET_DEADLINE(ticks);
+  pTimer->state    = SFTM_TIMER_RUNNING;
+
+#if (SFTM_CFG_GROUPS)
+  if (pTimer->group != NO_GROUP)
   {
-    newTimerNumber = CurrentTimersNumber++;
+    SFTM_TimerGroup_T *pGroup = &GroupsArray[pTimer->group];
+
+    /* Time of paused group does not count, timer started now has its full timeout after resume */
+    pTimer->groupEpoch  = pGroup->epoch;
+    pTimer->groupOffset = pGroup->offset + (pGroup->paused ? TimersTick - pGroup->pauseTick : 0);
   }
-  else
+  else { /* Do nothing */ }
+#endif
+
+  InsertTimer(timerIdx);
+}
+
+static void UnscheduleTimer(uint8_t timerIdx)
+{
+  SFTM_Timer_T *pTimer = &TimersArray[timerIdx];
+
+  NOTE_TIMER_CHANGE(timerIdx);
+
+  if (pTimer->heapIdx != NOT_IN_HEAP)
   {
-    SFTM_ExecuteHardFault();
+    HeapRemove(timerIdx);
+  }
+  else if (SFTM_TIMER_RUNNING == pTimer->state)
+  {
+    FarTimersNumber--;
+  }
+#if (SFTM_CFG_GROUPS)
+  else if (SFTM_TIMER_PARKED == pTimer->state)
+  {
+    UnparkTimer(timerIdx);
   }
+#endif
+  else { /* Do nothing */ }
+}
 
-  return (SFTM_TimerHandle_T)&TimersArray[newTimerNumber];
+static SFTM_ticks GetEffectiveDeadline(const SFTM_Timer_T *pTimer)
+{
+  SFTM_ticks deadline = TIMER_DEADLINE(pTimer);
+
+#if (SFTM_CFG_GROUPS)
+  /* Group postponement and pause not applied to timer yet */
+  if (pTimer->group != NO_GROUP)
+  {
+    const SFTM_TimerGroup_T *pGroup = &GroupsArray[pTimer->group];
+
+    deadline += pGroup->offset - pTimer->groupOffset;
+    if (pGroup->paused)
+    {
+      deadline += TimersTick - pGroup->pauseTick;
+    }
+    else { /* Do nothing */ }
+  }
+  else { /* Do nothing */ }
+#endif
+
+  return deadline;
 }
 
-SFTM_TimerRet_T SFTM_StartTimer(SFTM_TimerHandle_T timerHandle, SFTM_TimerType_T timerType, SFTM_TimerCallback_T onExpire, void* pContext, SFTM_timeoutMS timeout)
+#if (SFTM_CFG_SUBTICK)
+static uint64_t GetRemainingTimeNs(const SFTM_Timer_T *pTimer)
 {
-  SFTM_TimerRet_T ret;
+  uint64_t remainingNs;
+  uint64_t tickElapsedNs;
+  SFTM_ticks deadline;
 
-  if (timerHandle->ticks <= timerHandle->timeout)
+  switch (pTimer->state)
   {
-    ret = SFTM_TIMER_IN_USE;
+    case SFTM_TIMER_RUNNING:
+      deadline = GetEffectiveDeadline(pTimer);
+      remainingNs = IS_BEFORE(TimersTick, deadline) ? (uint64_t)(SFTM_ticks)(deadline - TimersTick) * NS_PER_TIMERS_TICK : 0;
+
+      /* Time elapsed since timers tick, port source adds part of System tick ISR period and periods of pending ISR */
+      tickElapsedNs = (uint64_t)BaseTicks * NS_PER_BASE_TICK + SFTM_PortGetSubTickNs();
+      remainingNs = (remainingNs > tickElapsedNs) ? remainingNs - tickElapsedNs : 0;
+      break;
+    case SFTM_TIMER_PARKED:
+      remainingNs = (uint64_t)(SFTM_ticks)(GetEffectiveDeadline(pTimer) - TimersTick) * NS_PER_TIMERS_TICK;
+      break;
+    case SFTM_TIMER_PAUSED:
+      /* Paused timer keeps remaining ticks instead of deadline */
+      remainingNs = (uint64_t)pTimer->deadline * NS_PER_TIMERS_TICK;
+      break;
+    default:
+      remainingNs = 0;
+      break;
   }
-  else
+
+  return remainingNs;
+}
+#endif
+
+#if (SFTM_CFG_GROUPS)
+
+static void SyncGroupMembership(uint8_t timerIdx)
+{
+  SFTM_Timer_T *pTimer = &TimersArray[timerIdx];
+
+  /* Timer of stopped group is stopped lazily, on first access */
+  if (pTimer->group != NO_GROUP && pTimer->groupEpoch != GroupsArray[pTimer->group].epoch &&
+      pTimer->state != SFTM_TIMER_IDLE)
   {
-    timerHandle->timerType    = timerType;
-    timerHandle->onExpire     = onExpire;
-    timerHandle->pContext     = pContext;
-    timerHandle->timeout      = timeout;
-    timerHandle->ticks        = 0;
-    timerHandle->expiredFlag  = false;
+    UnscheduleTimer(timerIdx);
+    pTimer->state = SFTM_TIMER_IDLE;
+  }
+  else { /* Do nothing */ }
+}
 
-    ret = SFTM_TIMER_STARTED;
+static void UnparkTimer(uint8_t timerIdx)
+{
+  uint8_t *pLink = &GroupsArray[TimersArray[timerIdx].group].parkedHead;
+
+  while (*pLink != NO_TIMER && *pLink != timerIdx)
+  {
+    pLink = &TimersArray[*pLink].nextParked;
   }
 
-  return ret;
+  if (*pLink == timerIdx)
+  {
+    *pLink = TimersArray[timerIdx].nextParked;
+  }
+  else { /* Do nothing */ }
 }
 
-void SFTM_StopTimer(SFTM_TimerHandle_T timerHandle)
+static bool ApplyGroup(uint8_t timerIdx)
 {
-  timerHandle->ticks        = TIMIER_IDLE_VALUE;
-  timerHandle->timeout      = 0;
-  timerHandle->expiredFlag  = false;
-  timerHandle->onExpire     = NULL;
-  timerHandle->pContext     = NULL;
+  SFTM_Timer_T *pTimer = &TimersArray[timerIdx];
+  SFTM_TimerGroup_T *pGroup = &GroupsArray[pTimer->group];
+  bool expire = false;
+
+  if (pTimer->groupEpoch != pGroup->epoch)
+  {
+    /* Group was stopped */
+    pTimer->state = SFTM_TIMER_IDLE;
+  }
+  else if (pGroup->paused)
+  {
+    /* Park timer until group is resumed */
+    pTimer->state = SFTM_TIMER_PARKED;
+    pTimer->nextParked = pGroup->parkedHead;
+    pGroup->parkedHead = timerIdx;
+  }
+  else if (pTimer->groupOffset != pGroup->offset)
+  {
+    /* Group was postponed, move timer by the same time */
+    pTimer->deadline += pGroup->offset - pTimer->groupOffset;
+    pTimer->groupOffset = pGroup->offset;
+
+    if (IS_BEFORE(TimersTick, pTimer->deadline))
+    {
+      InsertTimer(timerIdx);
+    }
+    else
+    {
+      expire = true;
+    }
+  }
+  else
+  {
+    expire = true;
+  }
+
+  return expire;
 }
+#endif
 
-void SFTM_RestartTimer(SFTM_TimerHandle_T timerHandle)
+static void MigrateFarTimers(void)
 {
-  timerHandle->ticks        = 0;
-  timerHandle->expiredFlag  = false;
+  for (uint8_t timerCnt = 0; timerCnt < CurrentTimersNumber; timerCnt++)
+  {
+    SFTM_Timer_T *pTimer = &TimersArray[timerCnt];
+
+    /* Remaining ticks of far timer are always positive, it is migrated long before deadline */
+    if (SFTM_TIMER_RUNNING == pTimer->state && NOT_IN_HEAP == pTimer->heapIdx &&
+        (SFTM_ticks)(TIMER_DEADLINE(pTimer) - TimersTick) < FAR_TIMEOUT)
+    {
+      HeapInsert(timerCnt);
+      FarTimersNumber--;
+    }
+    else { /* Do nothing */ }
+  }
 }
 
-void SFTM_TimersEventsHandler(void)
+static void ExpireDueTimers(void)
 {
-  for (uint8_t timerCnt = 0; timerCnt < MAX_TIMER_SLOTS; timerCnt++)
+  bool timersExpired = false;
+
+  while (TimersHeapSize != 0 && !IS_BEFORE(TimersTick, TIMER_DEADLINE(&TimersArray[TimersHeap[0]])))
   {
-    if (true == TimersArray[timerCnt].expiredFlag)
+    uint8_t timerIdx = TimersHeap[0];
+    bool expire = true;
+
+    HeapRemove(timerIdx);
+#if (SFTM_CFG_GROUPS)
+    /* Timer can be stopped, parked or moved by its group instead */
+    expire = (NO_GROUP == TimersArray[timerIdx].group) || ApplyGroup(timerIdx);
+#endif
+
+    if (expire)
     {
-      /* Call timer event if is not NULL */
-      if (TimersArray[timerCnt].onExpire != NULL)
+      TimersArray[timerIdx].state = SFTM_TIMER_EXPIRED;
+
+      /* Timer already waiting in the queue is dispatched from its current position */
+      if (!TimersArray[timerIdx].queued)
       {
-        TimersArray[timerCnt].onExpire(TimersArray[timerCnt].pContext);
+        TimersArray[timerIdx].queued = true;
+        ExpiredQueue[ExpiredQueueHead] = timerIdx;
+        ExpiredQueueHead = (uint8_t)((ExpiredQueueHead + 1) % EXPIRED_QUEUE_SIZE);
       }
       else { /* Do nothing */ }
 
-      if (SFTM_ONE_SHOT == TimersArray[timerCnt].timerType)
-      {
-        /* No more calls onExpire function */
-        TimersArray[timerCnt].expiredFlag = false;
-      }
-      else // SFTM_AUTO_RELOAD
-      {
-        SFTM_RestartTimer(&TimersArray[timerCnt]);
-      }
-    }
-    else
-    {
-      /* Do nothing */
+      SFTM_TRACE(SFTM_TRACE_EXPIRE, timerIdx);
+#if (SFTM_CFG_LATENESS)
+      SFTM_StatsRecordExpiry(timerIdx, GET_BASE_TIME());
+#endif
+      timersExpired = true;
     }
+    else { /* Do nothing */ }
   }
+
+  if (timersExpired)
+  {
+    SFTM_PortNotifyEvents();
+  }
+  else { /* Do nothing */ }
 }
 
-SFTM_TimerStatus_T SFTM_GetTimerStatus(SFTM_TimerHandle_T timerHandle)
+static void MoveTimersTick(SFTM_ticks ticks)
 {
-  if (timerHandle->ticks > timerHandle->timeout)
+  SFTM_ticks previousTick = TimersTick;
+
+  TimersTick = previousTick + ticks;
+
+  if (TimersTick < previousTick)
   {
-    return SFTM_EXPIRED;
+    TimersEpoch++;
+  }
+  else { /* Do nothing */ }
+
+  if (FarTimersNumber != 0 && 0 == (TimersTick & (FAR_SCAN_PERIOD - 1)))
+  {
+    MigrateFarTimers();
+  }
+  else { /* Do nothing */ }
+
+  ExpireDueTimers();
+}
+
+static uint64_t GetBaseTimeNs(void)
+{
+  uint64_t systemTick = ((uint64_t)TimersEpoch << 32) | TimersTick;
+
+  return (systemTick * (TICK_CMP) + BaseTicks) * NS_PER_BASE_TICK;
+}
+
+#if (SFTM_CFG_HIRES)
+static SFTM_ticks GetHiResTicksToNextDeadline(void)
+{
+  uint64_t timeNs = SFTM_HiResGetTimeUntilNextDeadline(GetBaseTimeNs());
+
+  /* Round up, deadline within a tick must not be slept through as 0 ticks */
+  if (timeNs >= (uint64_t)SFTM_NO_EXPIRY * NS_PER_TIMERS_TICK)
+  {
+    return SFTM_NO_EXPIRY;
   }
   else
   {
-    return SFTM_NOT_EXPIRED;
+    return (SFTM_ticks)((timeNs + NS_PER_TIMERS_TICK - 1) / NS_PER_TIMERS_TICK);
   }
 }
+#endif
 
-uint32_t SFTM_GetTimerTick(SFTM_TimerHandle_T timerHandle)
+static SFTM_ticks GetTicksToNextExpiry(void)
 {
-  return timerHandle->ticks;
+  SFTM_ticks ticks = SFTM_NO_EXPIRY;
+
+  if (ExpiredQueueTail != ExpiredQueueHead)
+  {
+    ticks = 0;
+  }
+  else
+  {
+    if (TimersHeapSize != 0)
+    {
+      SFTM_ticks earliestDeadline = TIMER_DEADLINE(&TimersArray[TimersHeap[0]]);
+
+      ticks = IS_BEFORE(TimersTick, earliestDeadline) ? earliestDeadline - TimersTick : 0;
+    }
+    else { /* Do nothing */ }
+
+    /* Far future timers are not due before next scan, but scan has to happen */
+    if (FarTimersNumber != 0)
+    {
+      ticks = MIN(ticks, FAR_SCAN_PERIOD - (TimersTick & (FAR_SCAN_PERIOD - 1)));
+    }
+    else { /* Do nothing */ }
+
+#if (SFTM_CFG_HIRES)
+    ticks = SFTM_HiResHasExpiredTimers() ? 0 : MIN(ticks, GetHiResTicksToNextDeadline());
+#endif
+  }
+
+  return ticks;
 }
 
-uint8_t SFTM_GetCurrentTimersNumberInSystem(void)
+static bool PopExpiredTimer(uint8_t *pTimerIdx, SFTM_Callback_T *pCallback)
 {
-  return CurrentTimersNumber;
+  bool popped = false;
+
+  SFTM_ENTER_CRITICAL();
+  while (!popped && ExpiredQueueTail != ExpiredQueueHead)
+  {
+    uint8_t timerIdx = ExpiredQueue[ExpiredQueueTail];
+
+    ExpiredQueueTail = (uint8_t)((ExpiredQueueTail + 1) % EXPIRED_QUEUE_SIZE);
+    TimersArray[timerIdx].queued = false;
+    SYNC_GROUP(timerIdx);
+
+    /* Timer could be stopped or restarted after expiration, callback is taken once so it cannot change under dispatch */
+    if (SFTM_TIMER_EXPIRED == TimersArray[timerIdx].state)
+    {
+      *pTimerIdx = timerIdx;
+      pCallback->onExpire = GET_ON_EXPIRE(timerIdx);
+      pCallback->pContext = GET_CONTEXT(timerIdx);
+      popped = true;
+    }
+    else { /* Do nothing */ }
+  }
+  SFTM_EXIT_CRITICAL();
+
+  return popped;
 }
 
-uint8_t SFTM_MaxTimersNumberInSystem(void)
+static void ResetTimerSlot(uint8_t timerIdx)
 {
-  return MAX_TIMER_SLOTS;
+  SFTM_Timer_T *pTimer = &TimersArray[timerIdx];
+
+  pTimer->deadline     = 0;
+  pTimer->state        = SFTM_TIMER_IDLE;
+  pTimer->heapIdx      = NOT_IN_HEAP;
+  pTimer->queued       = false;
+#if (SFTM_CFG_GROUPS)
+  pTimer->group        = NO_GROUP;
+  pTimer->nextParked   = NO_TIMER;
+#endif
+#if (SFTM_CFG_EVENT_QUEUE)
+  pTimer->pEventQueue  = NULL;
+  pTimer->overruns     = 0;
+#endif
 }
 
+static void ClearConfig(TimerConfig_T *pConfig)
+{
+  pConfig->timeout  = 0;
+#if (SFTM_CFG_COMPACT)
+  pConfig->callbackId = SFTM_NO_CALLBACK_ID;
+#else
+  pConfig->onExpire = NULL;
+  pConfig->pContext = NULL;
+#endif
+}
+
+static void SetCallback(TimerConfig_T *pConfig, SFTM_TimerCallback_T onExpire, void *pContext)
+{
+#if (SFTM_CFG_COMPACT)
+  uint8_t callbackId = SFTM_NO_CALLBACK_ID;
+
+  ReleaseCallback(pConfig->callbackId);
+
+  /* Table has to fit distinct pairs of timers which are not stopped */
+  if (onExpire != NULL || pContext != NULL)
+  {
+    callbackId = FindCallbackId(onExpire, pContext, CallbacksArray, CurrentCallbacksNumber);
+
+    /* Entry no timer refers to any more is reused */
+    for (uint8_t callbackCnt = 0; SFTM_NO_CALLBACK_ID == callbackId && callbackCnt < CurrentCallbacksNumber; callbackCnt++)
+    {
+      if (0 == CallbackReferences[callbackCnt])
+      {
+        callbackId = callbackCnt;
+      }
+      else { /* Do nothing */ }
+    }
+
+    if (SFTM_NO_CALLBACK_ID == callbackId && CurrentCallbacksNumber < MAX_COMPACT_CALLBACKS)
+    {
+      callbackId = CurrentCallbacksNumber++;
+    }
+    else { /* Do nothing */ }
+
+    if (SFTM_NO_CALLBACK_ID == callbackId)
+    {
+      SFTM_ExecuteHardFault();
+    }
+    else
+    {
+      CallbacksArray[callbackId].onExpire = onExpire;
+      CallbacksArray[callbackId].pContext = pContext;
+      CallbackReferences[callbackId]++;
+    }
+  }
+  else { /* Do nothing */ }
+
+  pConfig->callbackId = callbackId;
+#else
+  pConfig->onExpire = onExpire;
+  pConfig->pContext = pContext;
+#endif
+}
+
+#if (SFTM_CFG_COMPACT)
+static void ReleaseCallback(uint8_t callbackId)
+{
+  if (callbackId != SFTM_NO_CALLBACK_ID)
+  {
+    CallbackReferences[callbackId]--;
+  }
+  else { /* Do nothing */ }
+}
+#endif
+
+#if (SFTM_CFG_STATIC_TIMERS) && !(SFTM_CFG_ROM_DESCRIPTORS)
+static void SetConfig(TimerConfig_T *pConfig, const SFTM_TimerConfig_T *pSource)
+{
+  pConfig->timerType = pSource->timerType;
+  pConfig->timeout   = pSource->timeout;
+  pConfig->onExpire  = pSource->onExpire;
+  pConfig->pContext  = pSource->pContext;
+}
+#endif
+
+static void StartConfiguredTimer(uint8_t timerIdx)
+{
+  ScheduleTimer(timerIdx, GET_CONFIG(timerIdx)->timeout);
+
+  SFTM_TRACE(SFTM_TRACE_START, timerIdx);
+}
+
+static SFTM_TimerRet_T StartTimer(uint8_t timerIdx, SFTM_TimerType_T timerType, SFTM_TimerCallback_T onExpire, void *pContext, SFTM_timeoutMS timeout)
+{
+  SFTM_TimerRet_T ret;
+
+  SYNC_GROUP(timerIdx);
+
+  if (TimersArray[timerIdx].state != SFTM_TIMER_IDLE)
+  {
+    ret = SFTM_TIMER_IN_USE;
+  }
+  else if (!IS_CONFIG_WRITABLE(timerIdx))
+  {
+    /* Static timer configuration is in ROM, it is started with SFTM_StartStaticTimer only */
+    SFTM_ExecuteHardFault();
+    ret = SFTM_TIMER_IN_USE;
+  }
+#if (SFTM_CFG_COMPACT)
+  else if (timeout > SFTM_COMPACT_MAX_TIMEOUT)
+  {
+    /* Deadline of compact timer has to stay within half of its 16-bit range */
+    SFTM_ExecuteHardFault();
+    ret = SFTM_TIMER_IN_USE;
+  }
+#endif
+  else
+  {
+    TimerConfig_T *pConfig = GET_WRITABLE_CONFIG(timerIdx);
+
+    pConfig->timerType    = timerType;
+    pConfig->timeout      = timeout;
+    SetCallback(pConfig, onExpire, pContext);
+
+    StartConfiguredTimer(timerIdx);
+    ret = SFTM_TIMER_STARTED;
+  }
+
+  return ret;
+}
+
+static void StopTimer(uint8_t timerIdx)
+{
+  UnscheduleTimer(timerIdx);
+  TimersArray[timerIdx].state = SFTM_TIMER_IDLE;
+
+  if (IS_CONFIG_WRITABLE(timerIdx))
+  {
+#if (SFTM_CFG_COMPACT)
+    ReleaseCallback(GET_WRITABLE_CONFIG(timerIdx)->callbackId);
+#endif
+    ClearConfig(GET_WRITABLE_CONFIG(timerIdx));
+  }
+  else { /* Do nothing */ }
+
+  SFTM_TRACE(SFTM_TRACE_STOP, timerIdx);
+}
+
+static void RestartTimer(uint8_t timerIdx)
+{
+  SYNC_GROUP(timerIdx);
+
+  if (TimersArray[timerIdx].state != SFTM_TIMER_IDLE)
+  {
+    UnscheduleTimer(timerIdx);
+    ScheduleTimer(timerIdx, GET_CONFIG(timerIdx)->timeout);
+
+    SFTM_TRACE(SFTM_TRACE_RESTART, timerIdx);
+  }
+  else { /* Do nothing */ }
+}
+
+#if (SFTM_CFG_EVENT_QUEUE)
+static bool PostEvent(uint8_t timerIdx, void *pContext)
+{
+  SFTM_Timer_T *pTimer = &TimersArray[timerIdx];
+  SFTM_EventQueue_T *pQueue = pTimer->pEventQueue;
+
+  if (pQueue != NULL)
+  {
+    uint16_t nextHead = (uint16_t)((pQueue->head + 1) % pQueue->size);
+
+    if (nextHead != pQueue->tail)
+    {
+      pQueue->pEvents[pQueue->head].pContext = pContext;
+      pQueue->pEvents[pQueue->head].timerIdx = timerIdx;
+      pQueue->pEvents[pQueue->head].overruns = pTimer->overruns;
+      pQueue->head = nextHead;
+      pTimer->overruns = 0;
+    }
+    else if (pTimer->overruns < UINT8_MAX)
+    {
+      pTimer->overruns++;
+    }
+    else { /* Do nothing */ }
+  }
+  else { /* Do nothing */ }
+
+  return (pQueue != NULL);
+}
+#endif
+
+#if (SFTM_CFG_BATCH)
+static void CallBatch(Batch_T *pBatch)
+{
+  if (pBatch->contextsNumber != 0)
+  {
+    uint8_t contextsNumber = pBatch->contextsNumber;
+
+    /* Batch callback may start timers dispatched in next events handler call only */
+    pBatch->contextsNumber = 0;
+    pBatch->onExpireBatch(pBatch->pContexts, contextsNumber);
+  }
+  else { /* Do nothing */ }
+}
+
+static bool AddToBatch(SFTM_TimerCallback_T onExpire, void *pContext)
+{
+  bool added = false;
+
+  for (uint8_t batchCnt = 0; batchCnt < CurrentBatchesNumber; batchCnt++)
+  {
+    Batch_T *pBatch = &BatchesArray[batchCnt];
+
+    if (pBatch->onExpire == onExpire)
+    {
+      /* Auto reload timer can expire again while events are handled */
+      if (MAX_TIMER_SLOTS == pBatch->contextsNumber)
+      {
+        CallBatch(pBatch);
+      }
+      else { /* Do nothing */ }
+
+      pBatch->pContexts[pBatch->contextsNumber++] = pContext;
+      added = true;
+      break;
+    }
+    else { /* Do nothing */ }
+  }
+
+  return added;
+}
+#endif
+
+#if (SFTM_CFG_COMMAND_QUEUE)
+static bool PostCommand(const Command_T *pCommand)
+{
+  uint32_t position = SFTM_PORT_LOAD_ACQUIRE(&CommandQueueHead);
+  Command_T *pCell = NULL;
+
+  /* Producers race for head position, winner owns cell until it publishes command */
+  while (NULL == pCell)
+  {
+    Command_T *pCandidate = &CommandQueue[position & COMMAND_QUEUE_MASK];
+    int32_t lag = (int32_t)(SFTM_PORT_LOAD_ACQUIRE(&pCandidate->sequence) - position);
+
+    if (0 == lag)
+    {
+      if (SFTM_PORT_ATOMIC_COMPARE_EXCHANGE(&CommandQueueHead, &position, position + 1))
+      {
+        pCell = pCandidate;
+      }
+      else { /* Do nothing */ }
+    }
+    else if (lag < 0)
+    {
+      /* Cell keeps command of previous lap, queue is full */
+      break;
+    }
+    else
+    {
+      position = SFTM_PORT_LOAD_ACQUIRE(&CommandQueueHead);
+    }
+  }
+
+  if (pCell != NULL)
+  {
+    pCell->code      = pCommand->code;
+    pCell->timerIdx  = pCommand->timerIdx;
+    pCell->timerType = pCommand->timerType;
+    pCell->timeout   = pCommand->timeout;
+    pCell->onExpire  = pCommand->onExpire;
+    pCell->pContext  = pCommand->pContext;
+    SFTM_PORT_STORE_RELEASE(&pCell->sequence, position + 1);
+  }
+  else { /* Do nothing */ }
+
+  return (pCell != NULL);
+}
+
+static void ApplyCommands(void)
+{
+  Command_T *pCell = &CommandQueue[CommandQueueTail & COMMAND_QUEUE_MASK];
+
+  /* Commands are applied in claim order, unpublished one stops draining until next call.
+     Other writers hold critical section, so System tick ISR applies commands without locking. */
+  while (SFTM_PORT_LOAD_ACQUIRE(&pCell->sequence) == CommandQueueTail + 1)
+  {
+    switch (pCell->code)
+    {
+      case COMMAND_START:
+        (void)StartTimer(pCell->timerIdx, (SFTM_TimerType_T)pCell->timerType, pCell->onExpire, pCell->pContext, pCell->timeout);
+        break;
+      case COMMAND_STOP:
+        StopTimer(pCell->timerIdx);
+        break;
+      case COMMAND_RESTART:
+        RestartTimer(pCell->timerIdx);
+        break;
+      default:
+        break;
+    }
+
+    SFTM_PORT_STORE_RELEASE(&pCell->sequence, CommandQueueTail + SFTM_COMMAND_QUEUE_SIZE);
+    CommandQueueTail++;
+    pCell = &CommandQueue[CommandQueueTail & COMMAND_QUEUE_MASK];
+  }
+}
+#endif
+
+#if (SFTM_CFG_SNAPSHOT)
+static void PutUint32(uint8_t *pBuffer, uint32_t value)
+{
+  pBuffer[0] = (uint8_t)value;
+  pBuffer[1] = (uint8_t)(value >> 8);
+  pBuffer[2] = (uint8_t)(value >> 16);
+  pBuffer[3] = (uint8_t)(value >> 24);
+}
+
+static uint32_t GetUint32(const uint8_t *pBuffer)
+{
+  return (uint32_t)pBuffer[0] | ((uint32_t)pBuffer[1] << 8) | ((uint32_t)pBuffer[2] << 16) | ((uint32_t)pBuffer[3] << 24);
+}
+#endif
+
+#if (SFTM_CFG_SNAPSHOT) || (SFTM_CFG_COMPACT)
+static uint8_t FindCallbackId(SFTM_TimerCallback_T onExpire, void *pContext, const SFTM_Callback_T *pCallbacks, uint8_t callbacksNumber)
+{
+  uint8_t callbackId = SFTM_NO_CALLBACK_ID;
+
+  for (uint8_t callbackCnt = 0; callbackCnt < callbacksNumber; callbackCnt++)
+  {
+    if (pCallbacks[callbackCnt].onExpire == onExpire && pCallbacks[callbackCnt].pContext == pContext)
+    {
+      callbackId = callbackCnt;
+      break;
+    }
+    else { /* Do nothing */ }
+  }
+
+  return callbackId;
+}
+#endif
+
+/*======================================================================================*/
+/*                  ####### EXPORTED FUNCTIONS DEFINITIONS #######                      */
+/*======================================================================================*/
+void SFTM_Init(void)
+{
+  SFTM_PortInit();
+#if (SFTM_CFG_INSTRUMENTATION || SFTM_CFG_LATENESS)
+  /* Time source of statistics is enabled by port init above */
+  SFTM_StatsReset();
+#endif
+#if (SFTM_CFG_TRACE)
+  SFTM_TraceInit();
+#endif
+
+  for (uint8_t timerCnt = 0; timerCnt < MAX_TIMER_SLOTS; timerCnt++)
+  {
+    ResetTimerSlot(timerCnt);
+  }
+
+  /* Static timers keep configuration of their initializer, SFTM_StartStaticTimer copies it again */
+  for (uint8_t timerCnt = SFTM_STATIC_TIMERS_NUMBER; timerCnt < MAX_TIMER_SLOTS; timerCnt++)
+  {
+    ClearConfig(GET_WRITABLE_CONFIG(timerCnt));
+  }
+
+#if (SFTM_CFG_GROUPS)
+  for (uint8_t groupCnt = 0; groupCnt < MAX_TIMER_GROUPS; groupCnt++)
+  {
+    GroupsArray[groupCnt].epoch      = 0;
+    GroupsArray[groupCnt].offset     = 0;
+    GroupsArray[groupCnt].pauseTick  = 0;
+    GroupsArray[groupCnt].paused     = false;
+    GroupsArray[groupCnt].parkedHead = NO_TIMER;
+  }
+#endif
+
+#if (SFTM_CFG_BATCH)
+  CurrentBatchesNumber = 0;
+#endif
+#if (SFTM_CFG_COMPACT)
+  memset(CallbackReferences, 0, sizeof(CallbackReferences));
+  CurrentCallbacksNumber = 0;
+#endif
+#if (SFTM_CFG_COMMAND_QUEUE)
+  for (uint32_t commandCnt = 0; commandCnt < SFTM_COMMAND_QUEUE_SIZE; commandCnt++)
+  {
+    CommandQueue[commandCnt].sequence = commandCnt;
+  }
+  CommandQueueHead = 0;
+  CommandQueueTail = 0;
+#endif
+
+  TimersHeapSize    = 0;
+  ExpiredQueueHead  = 0;
+  ExpiredQueueTail  = 0;
+  FarTimersNumber   = 0;
+  DispatchedTimer   = NO_TIMER;
+
+#if (SFTM_CFG_HIRES)
+  SFTM_HiResInit();
+#endif
+}
+
+void SFTM_TimersHandler(void)
+{
+#if (SFTM_CFG_INSTRUMENTATION)
+  uint32_t entryCycles = SFTM_StatsGetCycles();
+#endif
+
+#if (SFTM_CFG_COMMAND_QUEUE)
+  ApplyCommands();
+#endif
+
+  BaseTicks++;
+
+  if (TICK_CMP == BaseTicks)
+  {
+    /* Clear base ticks */
+    BaseTicks = 0;
+
+    MoveTimersTick(1);
+  }
+  else
+  {
+    /* Do nothing */
+  }
+
+#if (SFTM_CFG_HIRES)
+  /* 64-bit engine time is computed only when high resolution deadline is due */
+  if (SFTM_HiResIsDue())
+  {
+    SFTM_HiResTimersHandler(GetBaseTimeNs());
+  }
+  else { /* Do nothing */ }
+#endif
+
+#if (SFTM_CFG_INSTRUMENTATION)
+  SFTM_StatsRecordTick(SFTM_StatsGetCycles() - entryCycles);
+#endif
+}
+
+SFTM_TimerHandle_T SFTM_CreateTimer(void)
+{
+  uint8_t newTimerNumber = 0;
+
+  if (CurrentTimersNumber < MAX_TIMER_SLOTS)
+  {
+    /* Slot is initialized on creation, so created timer can be used also before SFTM_Init */
+    newTimerNumber = CurrentTimersNumber++;
+    ResetTimerSlot(newTimerNumber);
+    ClearConfig(GET_WRITABLE_CONFIG(newTimerNumber));
+  }
+  else
+  {
+    /* All slots were created once, look for deleted one */
+    newTimerNumber = SFTM_STATIC_TIMERS_NUMBER;
+    while (newTimerNumber < MAX_TIMER_SLOTS && TimersArray[newTimerNumber].state != SFTM_TIMER_FREE)
+    {
+      newTimerNumber++;
+    }
+
+    if (newTimerNumber < MAX_TIMER_SLOTS)
+    {
+      ResetTimerSlot(newTimerNumber);
+      ClearConfig(GET_WRITABLE_CONFIG(newTimerNumber));
+    }
+    else
+    {
+      newTimerNumber = 0;
+      SFTM_ExecuteHardFault();
+    }
+  }
+
+  return (SFTM_TimerHandle_T)&TimersArray[newTimerNumber];
+}
+
+void SFTM_DeleteTimer(SFTM_TimerHandle_T timerHandle)
+{
+#if (SFTM_CFG_STATIC_TIMERS)
+  if (SFTM_GetTimerIndex(timerHandle) < SFTM_STATIC_TIMERS_NUMBER)
+  {
+    SFTM_ExecuteHardFault();
+  }
+  else { /* Do nothing */ }
+#endif
+
+  SFTM_ENTER_CRITICAL();
+  StopTimer(SFTM_GetTimerIndex(timerHandle));
+#if (SFTM_CFG_GROUPS)
+  timerHandle->group       = NO_GROUP;
+#endif
+#if (SFTM_CFG_EVENT_QUEUE)
+  timerHandle->pEventQueue = NULL;
+#endif
+  timerHandle->state       = SFTM_TIMER_FREE;
+  SFTM_EXIT_CRITICAL();
+}
+
+SFTM_TimerRet_T SFTM_StartTimer(SFTM_TimerHandle_T timerHandle, SFTM_TimerType_T timerType, SFTM_TimerCallback_T onExpire, void* pContext, SFTM_timeoutMS timeout)
+{
+  SFTM_TimerRet_T ret;
+
+  SFTM_ENTER_CRITICAL();
+  ret = StartTimer(SFTM_GetTimerIndex(timerHandle), timerType, onExpire, pContext, timeout);
+  SFTM_EXIT_CRITICAL();
+
+  return ret;
+}
+
+#if (SFTM_CFG_INLINE_CONTEXT)
+SFTM_TimerRet_T SFTM_StartTimerInline(SFTM_TimerHandle_T timerHandle, SFTM_TimerType_T timerType, SFTM_TimerCallback_T onExpire, const void *pCapture, uint8_t captureSize, SFTM_timeoutMS timeout)
+{
+  SFTM_TimerRet_T ret = SFTM_TIMER_IN_USE;
+
+  if (captureSize > SFTM_INLINE_CONTEXT_SIZE)
+  {
+    SFTM_ExecuteHardFault();
+  }
+  else
+  {
+    SFTM_ENTER_CRITICAL();
+    SYNC_GROUP(SFTM_GetTimerIndex(timerHandle));
+
+    /* Stopped timer is not dispatched, so context is not read while it is copied */
+    if (SFTM_TIMER_IDLE == timerHandle->state)
+    {
+      memcpy(timerHandle->inlineContext.bytes, pCapture, captureSize);
+      ret = StartTimer(SFTM_GetTimerIndex(timerHandle), timerType, onExpire, timerHandle->inlineContext.bytes, timeout);
+    }
+    else { /* Do nothing */ }
+    SFTM_EXIT_CRITICAL();
+  }
+
+  return ret;
+}
+#endif
+
+void SFTM_StopTimer(SFTM_TimerHandle_T timerHandle)
+{
+  SFTM_ENTER_CRITICAL();
+  StopTimer(SFTM_GetTimerIndex(timerHandle));
+  SFTM_EXIT_CRITICAL();
+}
+
+void SFTM_RestartTimer(SFTM_TimerHandle_T timerHandle)
+{
+  SFTM_ENTER_CRITICAL();
+  RestartTimer(SFTM_GetTimerIndex(timerHandle));
+  SFTM_EXIT_CRITICAL();
+}
+
+void SFTM_PauseTimer(SFTM_TimerHandle_T timerHandle)
+{
+  SFTM_ENTER_CRITICAL();
+  SYNC_GROUP(SFTM_GetTimerIndex(timerHandle));
+
+  if (SFTM_TIMER_RUNNING == timerHandle->state || SFTM_TIMER_PARKED == timerHandle->state)
+  {
+    SFTM_ticks deadline = GetEffectiveDeadline(timerHandle);
+
+    UnscheduleTimer(SFTM_GetTimerIndex(timerHandle));
+
+    /* Paused timer keeps remaining ticks instead of deadline */
+    timerHandle->deadline = IS_BEFORE(TimersTick, deadline) ? deadline - TimersTick : 0;
+    timerHandle->state    = SFTM_TIMER_PAUSED;
+  }
+  else if (SFTM_TIMER_EXPIRED == timerHandle->state)
+  {
+    /* Expired timer, also paused from its own callback, is not finished by events handler
+       and gets its full timeout after resume */
+    UnscheduleTimer(SFTM_GetTimerIndex(timerHandle));
+    timerHandle->deadline = GET_CONFIG(SFTM_GetTimerIndex(timerHandle))->timeout;
+    timerHandle->state    = SFTM_TIMER_PAUSED;
+  }
+  else { /* Do nothing */ }
+  SFTM_EXIT_CRITICAL();
+}
+
+void SFTM_ResumeTimer(SFTM_TimerHandle_T timerHandle)
+{
+  SYNC_GROUP_MEMBERSHIP(timerHandle);
+
+  SFTM_ENTER_CRITICAL();
+  if (SFTM_TIMER_PAUSED == timerHandle->state)
+  {
+    ScheduleTimer(SFTM_GetTimerIndex(timerHandle), timerHandle->deadline);
+  }
+  else { /* Do nothing */ }
+  SFTM_EXIT_CRITICAL();
+}
+
+void SFTM_TimersEventsHandler(void)
+{
+  uint8_t timerCnt;
+  SFTM_Callback_T callback;
+
+  /* Nested call from callback would dispatch next timers before current one is finished */
+  if (NO_TIMER == DispatchedTimer)
+  {
+    while (PopExpiredTimer(&timerCnt, &callback))
+    {
+#if (SFTM_CFG_LATENESS)
+      SFTM_StatsRecordDispatch(timerCnt, GET_BASE_TIME());
+#endif
+
+      DispatchedTimerChanged = false;
+
+      /* Call timer event if is not NULL, is not posted to queue and is not batched */
+      if (!POST_EVENT(timerCnt, callback.pContext) && callback.onExpire != NULL && !ADD_TO_BATCH(callback.onExpire, callback.pContext))
+      {
+        SFTM_TRACE(SFTM_TRACE_DISPATCH_BEGIN, timerCnt);
+        DispatchedTimer = timerCnt;
+#if (SFTM_CFG_INSTRUMENTATION)
+        uint32_t callCycles = SFTM_StatsGetCycles();
+        callback.onExpire(callback.pContext);
+        SFTM_StatsRecordCallback(timerCnt, SFTM_StatsGetCycles() - callCycles);
+#else
+        callback.onExpire(callback.pContext);
+#endif
+        DispatchedTimer = NO_TIMER;
+        SFTM_TRACE(SFTM_TRACE_DISPATCH_END, timerCnt);
+      }
+      else { /* Do nothing */ }
+
+      /* Timer stopped, deleted, restarted or started again in callback is left as callback set it,
+         even if it has already expired again */
+      SFTM_ENTER_CRITICAL();
+      if (DispatchedTimerChanged || TimersArray[timerCnt].state != SFTM_TIMER_EXPIRED)
+      {
+        /* Do nothing */
+      }
+      else if (SFTM_ONE_SHOT == GET_CONFIG(timerCnt)->timerType)
+      {
+        /* No more calls onExpire function */
+        TimersArray[timerCnt].state = SFTM_TIMER_DONE;
+      }
+      else // SFTM_AUTO_RELOAD
+      {
+        RestartTimer(timerCnt);
+      }
+      SFTM_EXIT_CRITICAL();
+    }
+
+#if (SFTM_CFG_BATCH)
+    for (uint8_t batchCnt = 0; batchCnt < CurrentBatchesNumber; batchCnt++)
+    {
+      CallBatch(&BatchesArray[batchCnt]);
+    }
+#endif
+
+#if (SFTM_CFG_HIRES)
+    SFTM_HiResEventsHandler();
+#endif
+  }
+  else { /* Do nothing */ }
+}
+
+void SFTM_Advance(SFTM_ticks ticks)
+{
+  SFTM_ticks remainingTicks = ticks;
+
+  do
+  {
+    SFTM_ticks step = remainingTicks;
+
+    SFTM_ENTER_CRITICAL();
+#if (SFTM_CFG_COMMAND_QUEUE)
+    /* Posted commands are applied before every step, as System tick ISR does before tick */
+    ApplyCommands();
+#endif
+    /* Jump straight to the earliest deadline, it may already be due */
+    if (TimersHeapSize != 0)
+    {
+      SFTM_ticks earliestDeadline = TIMER_DEADLINE(&TimersArray[TimersHeap[0]]);
+
+      step = MIN(step, IS_BEFORE(TimersTick, earliestDeadline) ? earliestDeadline - TimersTick : 0);
+    }
+    else { /* Do nothing */ }
+
+    /* Do not skip far future tier scans */
+    if (FarTimersNumber != 0)
+    {
+      step = MIN(step, FAR_SCAN_PERIOD - (TimersTick & (FAR_SCAN_PERIOD - 1)));
+    }
+    else { /* Do nothing */ }
+
+#if (SFTM_CFG_HIRES)
+    /* High resolution deadline within a tick expires at the end of that tick */
+    step = MIN(step, GetHiResTicksToNextDeadline());
+#endif
+
+    MoveTimersTick(step);
+#if (SFTM_CFG_HIRES)
+    SFTM_HiResTimersHandler(GetBaseTimeNs());
+#endif
+    remainingTicks -= step;
+    SFTM_EXIT_CRITICAL();
+
+    SFTM_TimersEventsHandler();
+  } while (remainingTicks != 0);
+}
+
+SFTM_TimerStatus_T SFTM_GetTimerStatus(SFTM_TimerHandle_T timerHandle)
+{
+  SYNC_GROUP_MEMBERSHIP(timerHandle);
+
+  if (SFTM_TIMER_IDLE == timerHandle->state || SFTM_TIMER_EXPIRED == timerHandle->state ||
+      SFTM_TIMER_DONE == timerHandle->state)
+  {
+    return SFTM_EXPIRED;
+  }
+  else
+  {
+    return SFTM_NOT_EXPIRED;
+  }
+}
+
+uint32_t SFTM_GetTimerTick(SFTM_TimerHandle_T timerHandle)
+{
+  uint32_t ticks;
+
+  SYNC_GROUP_MEMBERSHIP(timerHandle);
+
+  SFTM_ENTER_CRITICAL();
+  switch (timerHandle->state)
+  {
+    case SFTM_TIMER_RUNNING:
+    case SFTM_TIMER_PARKED:
+      ticks = GET_CONFIG(SFTM_GetTimerIndex(timerHandle))->timeout - (GetEffectiveDeadline(timerHandle) - TimersTick);
+      break;
+    case SFTM_TIMER_PAUSED:
+      ticks = GET_CONFIG(SFTM_GetTimerIndex(timerHandle))->timeout - timerHandle->deadline;
+      break;
+    case SFTM_TIMER_EXPIRED:
+    case SFTM_TIMER_DONE:
+      ticks = GET_CONFIG(SFTM_GetTimerIndex(timerHandle))->timeout;
+      break;
+    default:
+      ticks = TIMIER_IDLE_VALUE;
+      break;
+  }
+  SFTM_EXIT_CRITICAL();
+
+  return ticks;
+}
+
+#if (SFTM_CFG_SUBTICK)
+uint64_t SFTM_GetTimerTimeUs(SFTM_TimerHandle_T timerHandle)
+{
+  uint64_t timeoutNs;
+  uint64_t remainingNs;
+  uint64_t timeUs;
+
+  SYNC_GROUP_MEMBERSHIP(timerHandle);
+
+  SFTM_ENTER_CRITICAL();
+  if (SFTM_TIMER_IDLE == timerHandle->state || SFTM_TIMER_FREE == timerHandle->state)
+  {
+    timeUs = UINT64_MAX;
+  }
+  else
+  {
+    timeoutNs   = (uint64_t)GET_CONFIG(SFTM_GetTimerIndex(timerHandle))->timeout * NS_PER_TIMERS_TICK;
+    remainingNs = GetRemainingTimeNs(timerHandle);
+
+    /* Postponed timer may have more time left than its timeout */
+    timeUs = (timeoutNs > remainingNs) ? (timeoutNs - remainingNs) / NS_PER_US : 0;
+  }
+  SFTM_EXIT_CRITICAL();
+
+  return timeUs;
+}
+
+uint64_t SFTM_GetTimerRemainingUs(SFTM_TimerHandle_T timerHandle)
+{
+  uint64_t remainingNs;
+
+  SYNC_GROUP_MEMBERSHIP(timerHandle);
+
+  SFTM_ENTER_CRITICAL();
+  remainingNs = GetRemainingTimeNs(timerHandle);
+  SFTM_EXIT_CRITICAL();
+
+  return remainingNs / NS_PER_US;
+}
+#endif
+
+SFTM_ticks SFTM_GetSystemTick(void)
+{
+  return TimersTick;
+}
+
+uint64_t SFTM_GetSystemTick64(void)
+{
+  uint64_t systemTick;
+
+  SFTM_ENTER_CRITICAL();
+  systemTick = ((uint64_t)TimersEpoch << 32) | TimersTick;
+  SFTM_EXIT_CRITICAL();
+
+  return systemTick;
+}
+
+uint64_t SFTM_GetTimeNs(void)
+{
+  uint64_t timeNs;
+
+  SFTM_ENTER_CRITICAL();
+  timeNs = GetBaseTimeNs() + SFTM_PortGetSubTickNs();
+  SFTM_EXIT_CRITICAL();
+
+  return timeNs;
+}
+
+SFTM_ticks SFTM_GetTicksUntilNextExpiry(void)
+{
+  SFTM_ticks ticks;
+
+  SFTM_ENTER_CRITICAL();
+  ticks = GetTicksToNextExpiry();
+  SFTM_EXIT_CRITICAL();
+
+  return ticks;
+}
+
+SFTM_ticks SFTM_IdleSleep(void)
+{
+  SFTM_ticks sleptTicks = 0;
+
+  /* Tick stays masked from the query till crediting, so no timer can be started in between */
+  SFTM_ENTER_CRITICAL();
+  SFTM_ticks ticks = GetTicksToNextExpiry();
+
+  if (ticks != 0)
+  {
+    sleptTicks = SFTM_PortSleep(ticks);
+  }
+  else { /* Do nothing */ }
+
+  if (sleptTicks != 0)
+  {
+    MoveTimersTick(sleptTicks);
+#if (SFTM_CFG_HIRES)
+    SFTM_HiResTimersHandler(GetBaseTimeNs());
+#endif
+  }
+  else { /* Do nothing */ }
+  SFTM_EXIT_CRITICAL();
+
+  return sleptTicks;
+}
+
+SFTM_TimerHandle_T SFTM_GetTimerHandle(uint8_t timerIdx)
+{
+  return &TimersArray[timerIdx];
+}
+
+uint8_t SFTM_GetTimerIndex(SFTM_TimerHandle_T timerHandle)
+{
+  return (uint8_t)(timerHandle - TimersArray);
+}
+
+uint8_t SFTM_GetCurrentTimersNumberInSystem(void)
+{
+  return CurrentTimersNumber;
+}
+
+uint8_t SFTM_MaxTimersNumberInSystem(void)
+{
+  return MAX_TIMER_SLOTS;
+}
+
+void SFTM_ExecuteHardFault(void)
+{
+  SFTM_PortFault();
+}
+
+#if (SFTM_CFG_GROUPS)
+SFTM_TimerGroupHandle_T SFTM_CreateGroup(void)
+{
+  uint8_t newGroupNumber = 0;
+
+  if (CurrentGroupsNumber < MAX_TIMER_GROUPS)
+  {
+    newGroupNumber = CurrentGroupsNumber++;
+  }
+  else
+  {
+    SFTM_ExecuteHardFault();
+  }
+
+  return &GroupsArray[newGroupNumber];
+}
+
+void SFTM_AddTimerToGroup(SFTM_TimerHandle_T timerHandle, SFTM_TimerGroupHandle_T groupHandle)
+{
+  SFTM_ENTER_CRITICAL();
+  SYNC_GROUP(SFTM_GetTimerIndex(timerHandle));
+
+  if (SFTM_TIMER_IDLE == timerHandle->state)
+  {
+    timerHandle->group = (NULL == groupHandle) ? NO_GROUP : (uint8_t)(groupHandle - GroupsArray);
+  }
+  else { /* Do nothing */ }
+  SFTM_EXIT_CRITICAL();
+}
+
+void SFTM_StopGroup(SFTM_TimerGroupHandle_T groupHandle)
+{
+  SFTM_ENTER_CRITICAL();
+  groupHandle->epoch++;
+  groupHandle->parkedHead = NO_TIMER;
+  SFTM_EXIT_CRITICAL();
+}
+
+void SFTM_PauseGroup(SFTM_TimerGroupHandle_T groupHandle)
+{
+  SFTM_ENTER_CRITICAL();
+  if (!groupHandle->paused)
+  {
+    groupHandle->paused    = true;
+    groupHandle->pauseTick = TimersTick;
+  }
+  else { /* Do nothing */ }
+  SFTM_EXIT_CRITICAL();
+}
+
+void SFTM_ResumeGroup(SFTM_TimerGroupHandle_T groupHandle)
+{
+  SFTM_ENTER_CRITICAL();
+  if (groupHandle->paused)
+  {
+    groupHandle->offset += TimersTick - groupHandle->pauseTick;
+    groupHandle->paused  = false;
+
+    /* Only timers which reached their deadline during pause are touched */
+    while (groupHandle->parkedHead != NO_TIMER)
+    {
+      uint8_t timerIdx = groupHandle->parkedHead;
+      SFTM_Timer_T *pTimer = &TimersArray[timerIdx];
+
+      groupHandle->parkedHead = pTimer->nextParked;
+      pTimer->deadline   += groupHandle->offset - pTimer->groupOffset;
+      pTimer->groupOffset = groupHandle->offset;
+      pTimer->state       = SFTM_TIMER_RUNNING;
+      InsertTimer(timerIdx);
+    }
+  }
+  else { /* Do nothing */ }
+  SFTM_EXIT_CRITICAL();
+}
+
+void SFTM_ShiftGroup(SFTM_TimerGroupHandle_T groupHandle, SFTM_ticks ticks)
+{
+  SFTM_ENTER_CRITICAL();
+  groupHandle->offset += ticks;
+  SFTM_EXIT_CRITICAL();
+}
+#endif
+
+#if (SFTM_CFG_STATIC_TIMERS)
+SFTM_TimerRet_T SFTM_StartStaticTimer(SFTM_TimerHandle_T timerHandle)
+{
+  SFTM_TimerRet_T ret;
+
+  SFTM_ENTER_CRITICAL();
+  SYNC_GROUP(SFTM_GetTimerIndex(timerHandle));
+
+  if (timerHandle->state != SFTM_TIMER_IDLE)
+  {
+    ret = SFTM_TIMER_IN_USE;
+  }
+  else
+  {
+#if !(SFTM_CFG_ROM_DESCRIPTORS)
+    /* Slot configuration could be changed by SFTM_StartTimer or cleared on stop */
+    SetConfig(timerHandle, &StaticConfigsArray[SFTM_GetTimerIndex(timerHandle)]);
+#endif
+    StartConfiguredTimer(SFTM_GetTimerIndex(timerHandle));
+    ret = SFTM_TIMER_STARTED;
+  }
+  SFTM_EXIT_CRITICAL();
+
+  return ret;
+}
+#endif
+
+#if (SFTM_CFG_EVENT_QUEUE)
+void SFTM_InitEventQueue(SFTM_EventQueue_T *pQueue, SFTM_Event_T *pEvents, uint16_t size)
+{
+  /* Queue always keeps one slot empty, smaller one could not hold any event */
+  if (size < 2)
+  {
+    SFTM_ExecuteHardFault();
+  }
+  else { /* Do nothing */ }
+
+  pQueue->pEvents = pEvents;
+  pQueue->size    = size;
+  pQueue->head    = 0;
+  pQueue->tail    = 0;
+}
+
+void SFTM_SetTimerEventQueue(SFTM_TimerHandle_T timerHandle, SFTM_EventQueue_T *pQueue)
+{
+  timerHandle->pEventQueue = pQueue;
+  timerHandle->overruns    = 0;
+}
+
+bool SFTM_GetEvent(SFTM_EventQueue_T *pQueue, SFTM_Event_T *pEvent)
+{
+  bool taken = false;
+
+  if (pQueue->tail != pQueue->head)
+  {
+    *pEvent = pQueue->pEvents[pQueue->tail];
+    pQueue->tail = (uint16_t)((pQueue->tail + 1) % pQueue->size);
+    taken = true;
+  }
+  else { /* Do nothing */ }
+
+  return taken;
+}
+#endif
+
+#if (SFTM_CFG_BATCH)
+bool SFTM_RegisterBatchCallback(SFTM_TimerCallback_T onExpire, SFTM_BatchCallback_T onExpireBatch)
+{
+  bool registered = false;
+
+  if (CurrentBatchesNumber < MAX_BATCH_CALLBACKS)
+  {
+    Batch_T *pBatch = &BatchesArray[CurrentBatchesNumber++];
+
+    pBatch->onExpire       = onExpire;
+    pBatch->onExpireBatch  = onExpireBatch;
+    pBatch->contextsNumber = 0;
+    registered = true;
+  }
+  else { /* Do nothing */ }
+
+  return registered;
+}
+#endif
+
+#if (SFTM_CFG_SNAPSHOT)
+uint32_t SFTM_SaveSnapshot(uint8_t *pBuffer, uint32_t bufferSize, const SFTM_Callback_T *pCallbacks, uint8_t callbacksNumber)
+{
+  uint32_t size = SFTM_SNAPSHOT_SIZE(CurrentTimersNumber);
+
+  if (bufferSize < size)
+  {
+    return 0;
+  }
+  else { /* Do nothing */ }
+
+  pBuffer[0] = SNAPSHOT_MAGIC;
+  pBuffer[1] = SFTM_SNAPSHOT_VERSION;
+  pBuffer[2] = CurrentTimersNumber;
+  pBuffer[3] = 0;
+
+  for (uint8_t timerCnt = 0; timerCnt < CurrentTimersNumber; timerCnt++)
+  {
+    SFTM_Timer_T *pTimer = &TimersArray[timerCnt];
+    uint8_t *pRecord = &pBuffer[SNAPSHOT_HEADER_SIZE + timerCnt * SNAPSHOT_RECORD_SIZE];
+    SFTM_ticks remainingTicks = 0;
+    uint8_t callbackId = FindCallbackId(GET_ON_EXPIRE(timerCnt), GET_CONTEXT(timerCnt), pCallbacks, callbacksNumber);
+    uint8_t state;
+
+    /* Timer restored without its callback would lose expiry silently, configuration in ROM is not saved */
+    if (SFTM_NO_CALLBACK_ID == callbackId && (GET_ON_EXPIRE(timerCnt) != NULL || GET_CONTEXT(timerCnt) != NULL) &&
+        IS_CONFIG_WRITABLE(timerCnt))
+    {
+      return 0;
+    }
+    else { /* Do nothing */ }
+
+    SYNC_GROUP_MEMBERSHIP(pTimer);
+
+    SFTM_ENTER_CRITICAL();
+    state = pTimer->state;
+    if (SFTM_TIMER_RUNNING == state || SFTM_TIMER_PARKED == state)
+    {
+      SFTM_ticks effectiveDeadline = GetEffectiveDeadline(pTimer);
+
+      remainingTicks = IS_BEFORE(TimersTick, effectiveDeadline) ? effectiveDeadline - TimersTick : 0;
+      state = SFTM_TIMER_RUNNING;
+    }
+    else if (SFTM_TIMER_PAUSED == state)
+    {
+      remainingTicks = pTimer->deadline;
+    }
+    else { /* Do nothing */ }
+    SFTM_EXIT_CRITICAL();
+
+    PutUint32(&pRecord[0], remainingTicks);
+    PutUint32(&pRecord[4], GET_CONFIG(timerCnt)->timeout);
+    pRecord[8]  = (uint8_t)GET_CONFIG(timerCnt)->timerType;
+    pRecord[9]  = state;
+    pRecord[10] = callbackId;
+    pRecord[11] = 0;
+  }
+
+  return size;
+}
+
+bool SFTM_RestoreSnapshot(const uint8_t *pBuffer, uint32_t size, const SFTM_Callback_T *pCallbacks, uint8_t callbacksNumber)
+{
+  uint8_t timersNumber;
+
+  if (size < SNAPSHOT_HEADER_SIZE || pBuffer[0] != SNAPSHOT_MAGIC || pBuffer[1] != SFTM_SNAPSHOT_VERSION)
+  {
+    return false;
+  }
+  else { /* Do nothing */ }
+
+  timersNumber = pBuffer[2];
+  if (timersNumber > MAX_TIMER_SLOTS || size < SFTM_SNAPSHOT_SIZE(timersNumber) || CurrentTimersNumber > SFTM_STATIC_TIMERS_NUMBER)
+  {
+    return false;
+  }
+  else { /* Do nothing */ }
+
+  /* Static timer scheduled or waiting for dispatch would stay in heap or expired queue after overwrite */
+  for (uint8_t timerCnt = 0; timerCnt < CurrentTimersNumber; timerCnt++)
+  {
+    SYNC_GROUP_MEMBERSHIP(&TimersArray[timerCnt]);
+
+    if (TimersArray[timerCnt].queued || SFTM_TIMER_RUNNING == TimersArray[timerCnt].state ||
+        SFTM_TIMER_PARKED == TimersArray[timerCnt].state || SFTM_TIMER_EXPIRED == TimersArray[timerCnt].state)
+    {
+      return false;
+    }
+    else { /* Do nothing */ }
+  }
+
+  /* Validate all records first, so invalid snapshot leaves timers untouched */
+  for (uint8_t timerCnt = 0; timerCnt < timersNumber; timerCnt++)
+  {
+    const uint8_t *pRecord = &pBuffer[SNAPSHOT_HEADER_SIZE + timerCnt * SNAPSHOT_RECORD_SIZE];
+
+    if (pRecord[8] > SFTM_AUTO_RELOAD || pRecord[9] > SFTM_TIMER_FREE || SFTM_TIMER_PARKED == pRecord[9] ||
+        (pRecord[10] >= callbacksNumber && pRecord[10] != SFTM_NO_CALLBACK_ID))
+    {
+      return false;
+    }
+    else { /* Do nothing */ }
+
+#if (SFTM_CFG_COMPACT)
+    if (GetUint32(&pRecord[0]) > SFTM_COMPACT_MAX_TIMEOUT || GetUint32(&pRecord[4]) > SFTM_COMPACT_MAX_TIMEOUT)
+    {
+      return false;
+    }
+    else { /* Do nothing */ }
+#endif
+  }
+
+  SFTM_ENTER_CRITICAL();
+  for (uint8_t timerCnt = 0; timerCnt < timersNumber; timerCnt++)
+  {
+    const uint8_t *pRecord = &pBuffer[SNAPSHOT_HEADER_SIZE + timerCnt * SNAPSHOT_RECORD_SIZE];
+    SFTM_Timer_T *pTimer = &TimersArray[timerCnt];
+    SFTM_ticks remainingTicks = GetUint32(&pRecord[0]);
+
+    /* Configuration of static timers in ROM is kept */
+    if (IS_CONFIG_WRITABLE(timerCnt))
+    {
+      TimerConfig_T *pConfig = GET_WRITABLE_CONFIG(timerCnt);
+
+      pConfig->timeout   = GetUint32(&pRecord[4]);
+      pConfig->timerType = (SFTM_TimerType_T)pRecord[8];
+      if (pRecord[10] != SFTM_NO_CALLBACK_ID)
+      {
+        SetCallback(pConfig, pCallbacks[pRecord[10]].onExpire, pCallbacks[pRecord[10]].pContext);
+      }
+      else
+      {
+        SetCallback(pConfig, NULL, NULL);
+      }
+    }
+    else { /* Do nothing */ }
+    pTimer->state     = pRecord[9];
+
+    if (SFTM_TIMER_RUNNING == pTimer->state)
+    {
+      pTimer->deadline = GET_DEADLINE(remainingTicks);
+
+      /* Heap order is restored at once below */
+      if (remainingTicks < FAR_TIMEOUT)
+      {
+        pTimer->heapIdx = TimersHeapSize;
+        TimersHeap[TimersHeapSize++] = timerCnt;
+      }
+      else
+      {
+        FarTimersNumber++;
+      }
+    }
+    else if (SFTM_TIMER_PAUSED == pTimer->state)
+    {
+      pTimer->deadline = remainingTicks;
+    }
+    else if (SFTM_TIMER_EXPIRED == pTimer->state)
+    {
+      pTimer->queued = true;
+      ExpiredQueue[ExpiredQueueHead] = timerCnt;
+      ExpiredQueueHead = (uint8_t)((ExpiredQueueHead + 1) % EXPIRED_QUEUE_SIZE);
+    }
+    else { /* Do nothing */ }
+  }
+
+  for (uint8_t heapPos = TimersHeapSize / 2; heapPos > 0; heapPos--)
+  {
+    HeapSiftDown(heapPos - 1);
+  }
+  CurrentTimersNumber = MAX(CurrentTimersNumber, timersNumber);
+  SFTM_EXIT_CRITICAL();
+
+  if (ExpiredQueueTail != ExpiredQueueHead)
+  {
+    SFTM_PortNotifyEvents();
+  }
+  else { /* Do nothing */ }
+
+  return true;
+}
+#endif
+
+#if (SFTM_CFG_COMMAND_QUEUE)
+bool SFTM_PostStartTimer(SFTM_TimerHandle_T timerHandle, SFTM_TimerType_T timerType, SFTM_TimerCallback_T onExpire, void* pContext, SFTM_timeoutMS timeout)
+{
+  Command_T command = { .code = COMMAND_START, .timerIdx = SFTM_GetTimerIndex(timerHandle), .timerType = (uint8_t)timerType,
+                        .timeout = timeout, .onExpire = onExpire, .pContext = pContext };
+
+  return PostCommand(&command);
+}
+
+bool SFTM_PostStopTimer(SFTM_TimerHandle_T timerHandle)
+{
+  Command_T command = { .code = COMMAND_STOP, .timerIdx = SFTM_GetTimerIndex(timerHandle) };
+
+  return PostCommand(&command);
+}
+
+bool SFTM_PostRestartTimer(SFTM_TimerHandle_T timerHandle)
+{
+  Command_T command = { .code = COMMAND_RESTART, .timerIdx = SFTM_GetTimerIndex(timerHandle) };
+
+  return PostCommand(&command);
+}
+#endif
+
 /**
  * @}
  */
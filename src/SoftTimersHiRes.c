@@ -0,0 +1,430 @@
+/*=======================================================================================*
+ * @file    SoftTimersHiRes.c
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains all implementations for Soft Timers high resolution timers.
+ *======================================================================================*/
+
+/**
+ * @addtogroup SFTM Soft Timers Timers
+ * @{
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "SoftTimersHiRes.h"
+#include "SoftTimersPort.h"
+
+#if (SFTM_CFG_HIRES)
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+#define NS_PER_US                     1000ULL                             ///< Nanoseconds in microsecond
+#define NS_PER_BASE_TICK              (1000000000ULL / SYSTEM_TICK_ISR_CLK) ///< System tick ISR period in ns
+#define NO_DEADLINE                   UINT64_MAX                          ///< Next deadline when no timer runs
+#define NOT_IN_HEAP                   0xFF                                ///< Heap index of timer which is not running
+#define EXPIRED_QUEUE_SIZE            (MAX_HIRES_TIMER_SLOTS + 1)         ///< Expired timers queue size, one slot is always empty
+
+#if (MAX_HIRES_TIMER_SLOTS >= NOT_IN_HEAP)
+  #error "Maximum high resolution timer slots reached! Please decrease timer slot number."
+#endif
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+#define GET_TIMER_INDEX(timerHandle)  ((uint8_t)((timerHandle) - HiResTimersArray))  ///< Timer slot index
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*------------------------------- EXPORTED OBJECTS -------------------------------------*/
+
+/*-------------------------------- LOCAL OBJECTS ---------------------------------------*/
+static SFTM_HiResTimer_T HiResTimersArray[MAX_HIRES_TIMER_SLOTS]; ///< High resolution timers array
+static uint8_t CurrentHiResTimersNumber = 0;      ///< Current number of high resolution timers
+static uint64_t InitTime = 0;                     ///< Engine time of initialization in ns
+static volatile uint64_t NextDeadline = NO_DEADLINE; ///< Deadline of the earliest running timer in ns
+static uint32_t BaseTicksToDeadline = UINT32_MAX; ///< System tick ISR calls until the earliest deadline is due
+static uint8_t HiResHeap[MAX_HIRES_TIMER_SLOTS];  ///< Running timers indexes, min heap ordered by deadline
+static uint8_t HiResHeapSize = 0;                 ///< Number of running timers
+static volatile uint8_t ExpiredQueue[EXPIRED_QUEUE_SIZE]; ///< Expired timers indexes in expiration order
+static volatile uint8_t ExpiredQueueHead = 0;     ///< Expired timers queue write position
+static volatile uint8_t ExpiredQueueTail = 0;     ///< Expired timers queue read position
+
+/*======================================================================================*/
+/*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
+/*======================================================================================*/
+static void HeapSwap(uint8_t heapPosA, uint8_t heapPosB);
+static void HeapSiftUp(uint8_t heapPos);
+static void HeapSiftDown(uint8_t heapPos);
+static void HeapInsert(uint8_t timerIdx);
+static void HeapRemove(uint8_t timerIdx);
+static void UpdateNextDeadline(void);
+static void ArmDeadline(uint64_t timeNs);
+static void ExpireDueTimers(uint64_t timeNs);
+static bool PopExpiredTimer(uint8_t *pTimerIdx, SFTM_Callback_T *pCallback);
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+static void HeapSwap(uint8_t heapPosA, uint8_t heapPosB)
+{
+  uint8_t timerIdx = HiResHeap[heapPosA];
+
+  HiResHeap[heapPosA] = HiResHeap[heapPosB];
+  HiResHeap[heapPosB] = timerIdx;
+  HiResTimersArray[HiResHeap[heapPosA]].heapIdx = heapPosA;
+  HiResTimersArray[HiResHeap[heapPosB]].heapIdx = heapPosB;
+}
+
+static void HeapSiftUp(uint8_t heapPos)
+{
+  while (heapPos > 0)
+  {
+    uint8_t parentPos = (uint8_t)((heapPos - 1) / 2);
+
+    if (HiResTimersArray[HiResHeap[heapPos]].deadline < HiResTimersArray[HiResHeap[parentPos]].deadline)
+    {
+      HeapSwap(heapPos, parentPos);
+      heapPos = parentPos;
+    }
+    else
+    {
+      break;
+    }
+  }
+}
+
+static void HeapSiftDown(uint8_t heapPos)
+{
+  while (true)
+  {
+    uint16_t childPos = 2 * (uint16_t)heapPos + 1;
+    uint8_t earliestPos = heapPos;
+
+    if (childPos < HiResHeapSize &&
+        HiResTimersArray[HiResHeap[childPos]].deadline < HiResTimersArray[HiResHeap[earliestPos]].deadline)
+    {
+      earliestPos = (uint8_t)childPos;
+    }
+    else { /* Do nothing */ }
+
+    childPos++;
+    if (childPos < HiResHeapSize &&
+        HiResTimersArray[HiResHeap[childPos]].deadline < HiResTimersArray[HiResHeap[earliestPos]].deadline)
+    {
+      earliestPos = (uint8_t)childPos;
+    }
+    else { /* Do nothing */ }
+
+    if (earliestPos == heapPos)
+    {
+      break;
+    }
+    else
+    {
+      HeapSwap(heapPos, earliestPos);
+      heapPos = earliestPos;
+    }
+  }
+}
+
+static void HeapInsert(uint8_t timerIdx)
+{
+  uint8_t heapPos = HiResHeapSize++;
+
+  HiResHeap[heapPos] = timerIdx;
+  HiResTimersArray[timerIdx].heapIdx = heapPos;
+  HeapSiftUp(heapPos);
+}
+
+static void HeapRemove(uint8_t timerIdx)
+{
+  uint8_t heapPos = HiResTimersArray[timerIdx].heapIdx;
+  uint8_t lastPos = --HiResHeapSize;
+
+  HiResTimersArray[timerIdx].heapIdx = NOT_IN_HEAP;
+
+  if (heapPos != lastPos)
+  {
+    /* Fill the gap with the last timer and restore heap order */
+    uint8_t movedIdx = HiResHeap[lastPos];
+
+    HiResHeap[heapPos] = movedIdx;
+    HiResTimersArray[movedIdx].heapIdx = heapPos;
+    HeapSiftUp(heapPos);
+    HeapSiftDown(HiResTimersArray[movedIdx].heapIdx);
+  }
+  else { /* Do nothing */ }
+}
+
+static void UpdateNextDeadline(void)
+{
+  NextDeadline = (HiResHeapSize != 0) ? HiResTimersArray[HiResHeap[0]].deadline : NO_DEADLINE;
+}
+
+static void ArmDeadline(uint64_t timeNs)
+{
+  if (NextDeadline != NO_DEADLINE)
+  {
+    uint64_t delayNs = (NextDeadline > timeNs) ? NextDeadline - timeNs : 0;
+    uint64_t baseTicks = (delayNs + NS_PER_BASE_TICK - 1) / NS_PER_BASE_TICK;
+
+    /* Time with sub-tick part makes countdown end early only, handler then arms it again */
+    BaseTicksToDeadline = (baseTicks < UINT32_MAX) ? (uint32_t)baseTicks : UINT32_MAX;
+    SFTM_PortStartCompare(delayNs);
+  }
+  else
+  {
+    BaseTicksToDeadline = UINT32_MAX;
+  }
+}
+
+static void ExpireDueTimers(uint64_t timeNs)
+{
+  while (HiResHeapSize != 0 && HiResTimersArray[HiResHeap[0]].deadline <= timeNs)
+  {
+    uint8_t timerIdx = HiResHeap[0];
+    SFTM_HiResTimer_T *pTimer = &HiResTimersArray[timerIdx];
+
+    HeapRemove(timerIdx);
+
+    if (SFTM_AUTO_RELOAD == pTimer->timerType)
+    {
+      /* Reload from deadline to keep period, skip expirations which are already missed */
+      pTimer->deadline += pTimer->period * NS_PER_US;
+      if (pTimer->deadline <= timeNs)
+      {
+        pTimer->deadline = timeNs + pTimer->period * NS_PER_US;
+      }
+      else { /* Do nothing */ }
+      HeapInsert(timerIdx);
+    }
+    else
+    {
+      pTimer->state = SFTM_TIMER_EXPIRED;
+    }
+
+    /* Expiry is dispatched only if timer is not stopped or started again before */
+    pTimer->expiryPending = true;
+    if (!pTimer->queued)
+    {
+      pTimer->queued = true;
+      ExpiredQueue[ExpiredQueueHead] = timerIdx;
+      ExpiredQueueHead = (uint8_t)((ExpiredQueueHead + 1) % EXPIRED_QUEUE_SIZE);
+    }
+    else { /* Do nothing */ }
+  }
+
+  UpdateNextDeadline();
+  ArmDeadline(timeNs);
+  SFTM_PortNotifyEvents();
+}
+
+static bool PopExpiredTimer(uint8_t *pTimerIdx, SFTM_Callback_T *pCallback)
+{
+  bool popped = false;
+
+  SFTM_PORT_ENTER_CRITICAL();
+  while (!popped && ExpiredQueueTail != ExpiredQueueHead)
+  {
+    uint8_t timerIdx = ExpiredQueue[ExpiredQueueTail];
+    SFTM_HiResTimer_T *pTimer = &HiResTimersArray[timerIdx];
+
+    ExpiredQueueTail = (uint8_t)((ExpiredQueueTail + 1) % EXPIRED_QUEUE_SIZE);
+    pTimer->queued = false;
+
+    if (pTimer->expiryPending)
+    {
+      pTimer->expiryPending = false;
+      *pTimerIdx = timerIdx;
+      pCallback->onExpire = pTimer->onExpire;
+      pCallback->pContext = pTimer->pContext;
+      popped = true;
+    }
+    else { /* Do nothing */ }
+  }
+  SFTM_PORT_EXIT_CRITICAL();
+
+  return popped;
+}
+
+/*======================================================================================*/
+/*                  ####### EXPORTED FUNCTIONS DEFINITIONS #######                      */
+/*======================================================================================*/
+void SFTM_HiResInit(void)
+{
+  for (uint8_t timerCnt = 0; timerCnt < MAX_HIRES_TIMER_SLOTS; timerCnt++)
+  {
+    HiResTimersArray[timerCnt].deadline = 0;
+    HiResTimersArray[timerCnt].period   = 0;
+    HiResTimersArray[timerCnt].state    = SFTM_TIMER_IDLE;
+    HiResTimersArray[timerCnt].heapIdx  = NOT_IN_HEAP;
+    HiResTimersArray[timerCnt].queued   = false;
+    HiResTimersArray[timerCnt].expiryPending = false;
+    HiResTimersArray[timerCnt].onExpire = NULL;
+    HiResTimersArray[timerCnt].pContext = NULL;
+  }
+
+  InitTime          = SFTM_GetTimeNs();
+  NextDeadline      = NO_DEADLINE;
+  BaseTicksToDeadline = UINT32_MAX;
+  HiResHeapSize     = 0;
+  ExpiredQueueHead  = 0;
+  ExpiredQueueTail  = 0;
+}
+
+bool SFTM_HiResIsDue(void)
+{
+  return (0 == BaseTicksToDeadline) || (0 == --BaseTicksToDeadline);
+}
+
+void SFTM_HiResTimersHandler(uint64_t timeNs)
+{
+  if (timeNs >= NextDeadline)
+  {
+    ExpireDueTimers(timeNs);
+  }
+  else
+  {
+    ArmDeadline(timeNs);
+  }
+}
+
+void SFTM_HiResCompareHandler(void)
+{
+  SFTM_PORT_ENTER_CRITICAL();
+  uint64_t timeNs = SFTM_GetTimeNs();
+
+  if (timeNs >= NextDeadline)
+  {
+    ExpireDueTimers(timeNs);
+  }
+  else
+  {
+    /* Compare fired before deadline or for stopped timer, wait for the earliest one */
+    ArmDeadline(timeNs);
+  }
+  SFTM_PORT_EXIT_CRITICAL();
+}
+
+void SFTM_HiResEventsHandler(void)
+{
+  uint8_t timerIdx;
+  SFTM_Callback_T callback;
+
+  while (PopExpiredTimer(&timerIdx, &callback))
+  {
+    if (callback.onExpire != NULL)
+    {
+      callback.onExpire(callback.pContext);
+    }
+    else { /* Do nothing */ }
+
+    /* One shot timer started again by callback is left running */
+    SFTM_PORT_ENTER_CRITICAL();
+    if (SFTM_TIMER_EXPIRED == HiResTimersArray[timerIdx].state)
+    {
+      HiResTimersArray[timerIdx].state = SFTM_TIMER_DONE;
+    }
+    else { /* Do nothing */ }
+    SFTM_PORT_EXIT_CRITICAL();
+  }
+}
+
+bool SFTM_HiResHasExpiredTimers(void)
+{
+  return ExpiredQueueTail != ExpiredQueueHead;
+}
+
+uint64_t SFTM_HiResGetTimeUntilNextDeadline(uint64_t timeNs)
+{
+  uint64_t timeUntilDeadline;
+
+  if (NO_DEADLINE == NextDeadline)
+  {
+    timeUntilDeadline = UINT64_MAX;
+  }
+  else
+  {
+    timeUntilDeadline = (NextDeadline > timeNs) ? NextDeadline - timeNs : 0;
+  }
+
+  return timeUntilDeadline;
+}
+
+SFTM_HiResTimerHandle_T SFTM_CreateHiResTimer(void)
+{
+  uint8_t newTimerNumber = 0;
+
+  if (CurrentHiResTimersNumber < MAX_HIRES_TIMER_SLOTS)
+  {
+    newTimerNumber = CurrentHiResTimersNumber++;
+  }
+  else
+  {
+    SFTM_ExecuteHardFault();
+  }
+
+  return &HiResTimersArray[newTimerNumber];
+}
+
+SFTM_TimerRet_T SFTM_StartHiResTimer(SFTM_HiResTimerHandle_T timerHandle, SFTM_TimerType_T timerType, SFTM_TimerCallback_T onExpire, void* pContext, SFTM_timeoutUS timeout)
+{
+  SFTM_TimerRet_T ret = SFTM_TIMER_IN_USE;
+
+  SFTM_PORT_ENTER_CRITICAL();
+  if (SFTM_TIMER_IDLE == timerHandle->state)
+  {
+    uint64_t timeNs = SFTM_GetTimeNs();
+
+    timerHandle->timerType     = timerType;
+    timerHandle->onExpire      = onExpire;
+    timerHandle->pContext      = pContext;
+    timerHandle->period        = (timeout != 0) ? timeout : 1;
+    timerHandle->deadline      = timeNs + timerHandle->period * NS_PER_US;
+    timerHandle->state         = SFTM_TIMER_RUNNING;
+    timerHandle->expiryPending = false;
+    HeapInsert(GET_TIMER_INDEX(timerHandle));
+    UpdateNextDeadline();
+    ArmDeadline(timeNs);
+    ret = SFTM_TIMER_STARTED;
+  }
+  else { /* Do nothing */ }
+  SFTM_PORT_EXIT_CRITICAL();
+
+  return ret;
+}
+
+void SFTM_StopHiResTimer(SFTM_HiResTimerHandle_T timerHandle)
+{
+  SFTM_PORT_ENTER_CRITICAL();
+  if (timerHandle->heapIdx != NOT_IN_HEAP)
+  {
+    HeapRemove(GET_TIMER_INDEX(timerHandle));
+    UpdateNextDeadline();
+  }
+  else { /* Do nothing */ }
+  timerHandle->state         = SFTM_TIMER_IDLE;
+  timerHandle->expiryPending = false;
+  timerHandle->onExpire      = NULL;
+  timerHandle->pContext      = NULL;
+  SFTM_PORT_EXIT_CRITICAL();
+}
+
+SFTM_TimerStatus_T SFTM_GetHiResTimerStatus(SFTM_HiResTimerHandle_T timerHandle)
+{
+  return (timerHandle->state != SFTM_TIMER_RUNNING) ? SFTM_EXPIRED : SFTM_NOT_EXPIRED;
+}
+
+SFTM_timeUS SFTM_GetTimeUS(void)
+{
+  return (SFTM_GetTimeNs() - InitTime) / NS_PER_US;
+}
+
+#endif /* SFTM_CFG_HIRES */
+
+/**
+ * @}
+ */
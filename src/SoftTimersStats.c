@@ -0,0 +1,212 @@
+/*=======================================================================================*
+ * @file    SoftTimersStats.c
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains all implementations for Soft Timers statistics.
+ *======================================================================================*/
+
+/**
+ * @addtogroup SFTM Soft Timers Timers
+ * @{
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+#include <string.h>
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "SoftTimersPort.h"
+#include "SoftTimersStats.h"
+
+#if (SFTM_CFG_INSTRUMENTATION || SFTM_CFG_LATENESS)
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+/*======================================================================================*/
+/*                      ####### LOCAL TYPE DECLARATIONS #######                         */
+/*======================================================================================*/
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*------------------------------- EXPORTED OBJECTS -------------------------------------*/
+
+/*-------------------------------- LOCAL OBJECTS ---------------------------------------*/
+#if (SFTM_CFG_INSTRUMENTATION)
+static SFTM_Histogram_T TickHistogram;                          ///< Timers handler execution time histogram
+static SFTM_Histogram_T CallbackHistograms[MAX_TIMER_SLOTS];    ///< Callbacks execution time histograms
+#endif
+#if (SFTM_CFG_LATENESS)
+static SFTM_Histogram_T GlobalLatenessHistogram;                ///< Lateness histogram of all timers
+static SFTM_Histogram_T LatenessHistograms[MAX_TIMER_SLOTS];    ///< Lateness histograms of each timer
+static volatile uint32_t ExpiryTimes[MAX_TIMER_SLOTS];          ///< Last expiration time of each timer
+static uint32_t DispatchLateness = 0;                           ///< Lateness of currently dispatched timer
+#endif
+
+/*======================================================================================*/
+/*                    ####### LOCAL FUNCTIONS PROTOTYPES #######                        */
+/*======================================================================================*/
+static void RecordSample(SFTM_Histogram_T *pHistogram, uint32_t value);
+static uint8_t GetBucketIndex(uint32_t value);
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+static uint8_t GetBucketIndex(uint32_t value)
+{
+  uint8_t bucket;
+
+#if defined(__GNUC__)
+  bucket = (0 == value) ? 0 : (uint8_t)(32 - __builtin_clz(value));
+#else
+  for (bucket = 0; value != 0; bucket++)
+  {
+    value >>= 1;
+  }
+#endif
+
+  return (bucket < SFTM_STATS_HISTOGRAM_BUCKETS) ? bucket : (SFTM_STATS_HISTOGRAM_BUCKETS - 1);
+}
+
+static void RecordSample(SFTM_Histogram_T *pHistogram, uint32_t value)
+{
+  pHistogram->buckets[GetBucketIndex(value)]++;
+  pHistogram->samples++;
+  pHistogram->sum += value;
+
+  if (value > pHistogram->maxValue)
+  {
+    pHistogram->maxValue = value;
+  }
+  else { /* Do nothing */ }
+}
+
+/*======================================================================================*/
+/*                  ####### EXPORTED FUNCTIONS DEFINITIONS #######                      */
+/*======================================================================================*/
+void SFTM_StatsInit(void)
+{
+  SFTM_PortInit();
+  SFTM_StatsReset();
+}
+
+void SFTM_StatsReset(void)
+{
+#if (SFTM_CFG_INSTRUMENTATION)
+  memset(&TickHistogram, 0, sizeof(TickHistogram));
+  memset(CallbackHistograms, 0, sizeof(CallbackHistograms));
+#endif
+#if (SFTM_CFG_LATENESS)
+  memset(&GlobalLatenessHistogram, 0, sizeof(GlobalLatenessHistogram));
+  memset(LatenessHistograms, 0, sizeof(LatenessHistograms));
+#endif
+}
+
+uint32_t SFTM_StatsGetPercentile(const SFTM_Histogram_T *pHistogram, uint8_t percent)
+{
+  uint32_t threshold = (uint32_t)(((uint64_t)pHistogram->samples * percent + 99) / 100);
+  uint32_t samples = 0;
+  uint8_t bucket;
+
+  for (bucket = 0; bucket < SFTM_STATS_HISTOGRAM_BUCKETS - 1; bucket++)
+  {
+    samples += pHistogram->buckets[bucket];
+
+    if (samples >= threshold)
+    {
+      break;
+    }
+    else { /* Do nothing */ }
+  }
+
+  if (0 == bucket)
+  {
+    return 0;
+  }
+  else if (bucket < SFTM_STATS_HISTOGRAM_BUCKETS - 1 && ((1UL << bucket) - 1) < pHistogram->maxValue)
+  {
+    return (uint32_t)((1UL << bucket) - 1);
+  }
+  else
+  {
+    /* Overflow bucket or bucket with maximal value is bounded by maximal value */
+    return pHistogram->maxValue;
+  }
+}
+
+uint32_t SFTM_StatsGetMean(const SFTM_Histogram_T *pHistogram)
+{
+  return (0 == pHistogram->samples) ? 0 : (uint32_t)(pHistogram->sum / pHistogram->samples);
+}
+
+#if (SFTM_CFG_INSTRUMENTATION)
+uint32_t SFTM_StatsGetCycles(void)
+{
+#if defined(SFTM_STATS_GET_CYCLES)
+  return SFTM_STATS_GET_CYCLES();
+#else
+  return SFTM_PortGetCycles();
+#endif
+}
+
+void SFTM_StatsRecordTick(uint32_t cycles)
+{
+  RecordSample(&TickHistogram, cycles);
+}
+
+void SFTM_StatsRecordCallback(uint8_t timerIdx, uint32_t cycles)
+{
+  RecordSample(&CallbackHistograms[timerIdx], cycles);
+}
+
+const SFTM_Histogram_T* SFTM_StatsGetTickHistogram(void)
+{
+  return &TickHistogram;
+}
+
+const SFTM_Histogram_T* SFTM_StatsGetCallbackHistogram(SFTM_TimerHandle_T timerHandle)
+{
+  return &CallbackHistograms[SFTM_GetTimerIndex(timerHandle)];
+}
+
+#endif /* SFTM_CFG_INSTRUMENTATION */
+
+#if (SFTM_CFG_LATENESS)
+void SFTM_StatsRecordExpiry(uint8_t timerIdx, uint32_t time)
+{
+  ExpiryTimes[timerIdx] = time;
+}
+
+void SFTM_StatsRecordDispatch(uint8_t timerIdx, uint32_t time)
+{
+  DispatchLateness = time - ExpiryTimes[timerIdx];
+
+  RecordSample(&LatenessHistograms[timerIdx], DispatchLateness);
+  RecordSample(&GlobalLatenessHistogram, DispatchLateness);
+}
+
+uint32_t SFTM_StatsGetDispatchLateness(void)
+{
+  return DispatchLateness;
+}
+
+const SFTM_Histogram_T* SFTM_StatsGetLatenessHistogram(SFTM_TimerHandle_T timerHandle)
+{
+  return &LatenessHistograms[SFTM_GetTimerIndex(timerHandle)];
+}
+
+const SFTM_Histogram_T* SFTM_StatsGetGlobalLatenessHistogram(void)
+{
+  return &GlobalLatenessHistogram;
+}
+#endif /* SFTM_CFG_LATENESS */
+
+#endif /* SFTM_CFG_INSTRUMENTATION || SFTM_CFG_LATENESS */
+
+/**
+ * @}
+ */
@@ -0,0 +1,73 @@
+/*=======================================================================================*
+ * @file    SoftTimersTrace.c
+ * @author  Damian Pala
+ * @date    18-10-2026
+ * @brief   This file contains all implementations for Soft Timers trace.
+ *======================================================================================*/
+
+/**
+ * @addtogroup SFTM Soft Timers Timers
+ * @{
+ */
+
+/*======================================================================================*/
+/*                       ####### PREPROCESSOR DIRECTIVES #######                        */
+/*======================================================================================*/
+/*---------------------- INCLUDE DIRECTIVES FOR STANDARD HEADERS -----------------------*/
+#include <string.h>
+
+/*----------------------- INCLUDE DIRECTIVES FOR OTHER HEADERS -------------------------*/
+#include "SoftTimersPort.h"
+#include "SoftTimersTrace.h"
+
+#if (SFTM_CFG_TRACE)
+
+/*----------------------------- LOCAL OBJECT-LIKE MACROS -------------------------------*/
+#define TRACE_INDEX_MASK              (SFTM_TRACE_BUFFER_SIZE - 1)    ///< Mask of record index in ring
+
+/*---------------------------- LOCAL FUNCTION-LIKE MACROS ------------------------------*/
+
+/*======================================================================================*/
+/*                         ####### OBJECT DEFINITIONS #######                           */
+/*======================================================================================*/
+/*------------------------------- EXPORTED OBJECTS -------------------------------------*/
+
+/*-------------------------------- LOCAL OBJECTS ---------------------------------------*/
+static SFTM_TraceBuffer_T TraceBuffer;  ///< Trace buffer
+
+/*======================================================================================*/
+/*                  ####### EXPORTED FUNCTIONS DEFINITIONS #######                      */
+/*======================================================================================*/
+void SFTM_TraceInit(void)
+{
+  memset(&TraceBuffer, 0, sizeof(TraceBuffer));
+
+  TraceBuffer.magic           = SFTM_TRACE_MAGIC;
+  TraceBuffer.version         = SFTM_TRACE_VERSION;
+  TraceBuffer.recordsNumber   = SFTM_TRACE_BUFFER_SIZE;
+  TraceBuffer.timersClk       = TIMERS_CLK;
+  TraceBuffer.subTicksPerTick = SYSTEM_TICK_ISR_CLK / TIMERS_CLK;
+}
+
+void SFTM_TraceRecord(SFTM_TraceEvent_T event, uint8_t timerIdx, uint32_t tick, uint16_t subTick)
+{
+  /* Reserve record atomically, so ISR can preempt writer between reservation and write */
+  uint32_t recordIdx = SFTM_PORT_ATOMIC_FETCH_ADD(&TraceBuffer.head, 1) & TRACE_INDEX_MASK;
+  SFTM_TraceRecord_T *pRecord = &TraceBuffer.records[recordIdx];
+
+  pRecord->tick     = tick;
+  pRecord->subTick  = subTick;
+  pRecord->event    = (uint8_t)event;
+  pRecord->timerIdx = timerIdx;
+}
+
+const SFTM_TraceBuffer_T* SFTM_TraceGetBuffer(void)
+{
+  return &TraceBuffer;
+}
+
+#endif /* SFTM_CFG_TRACE */
+
+/**
+ * @}
+ */